@@ -106,6 +106,7 @@ struct CommandListCoreFamily : CommandListImp {
                                  ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                     NEO::GraphicsAllocation *srcptr,
+                                    size_t offset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
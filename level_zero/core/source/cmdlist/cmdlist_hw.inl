@@ -782,6 +782,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(ze_device_hand
             }
             /* Given MemAdvise hints, use different gpu Domain Handler for the Page Fault Handling */
             pageFaultManager->setGpuDomainHandler(L0::handleGpuDomainTransferForHwWithHints);
+            if (advice == ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION && allocData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(allocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+            }
         }
         deviceImp->memAdviseSharedAllocations[allocData] = flags;
         return ZE_RESULT_SUCCESS;
@@ -954,7 +957,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                                                       NEO::GraphicsAllocation *srcptr,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
 
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
 
@@ -962,16 +965,16 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
     uintptr_t rightSize = size % middleElSize;
     bool isStateless = false;
 
-    if (size >= 4ull * MemoryConstants::gigaByte) {
+    if (offset + size >= 4ull * MemoryConstants::gigaByte) {
         isStateless = true;
     }
 
     uint64_t dstAddress = dstptr->getGpuAddress();
     uint64_t srcAddress = srcptr->getGpuAddress();
     ze_result_t ret = appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                                   dstptr, 0,
+                                                   dstptr, offset,
                                                    reinterpret_cast<void *>(&srcAddress),
-                                                   srcptr, 0,
+                                                   srcptr, offset,
                                                    size - rightSize,
                                                    middleElSize,
                                                    Builtin::CopyBufferToBufferMiddle,
@@ -979,9 +982,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
                                                    isStateless);
     if (ret == ZE_RESULT_SUCCESS && rightSize) {
         appendMemoryCopyKernelWithGA(reinterpret_cast<void *>(&dstAddress),
-                                     dstptr, size - rightSize,
+                                     dstptr, offset + size - rightSize,
                                      reinterpret_cast<void *>(&srcAddress),
-                                     srcptr, size - rightSize,
+                                     srcptr, offset + size - rightSize,
                                      rightSize, 1UL,
                                      Builtin::CopyBufferToBufferSide,
                                      nullptr,
@@ -1340,6 +1343,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const voi
                                                                        size_t count) {
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     if (allocData) {
+        auto pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager && allocData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(allocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+        }
         return ZE_RESULT_SUCCESS;
     }
     return ZE_RESULT_ERROR_INVALID_ARGUMENT;
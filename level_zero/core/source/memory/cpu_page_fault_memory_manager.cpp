@@ -22,7 +22,7 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
                                                              allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+                                                             0, allocData->size, true);
     UNRECOVERABLE_IF(ret);
 }
 void PageFaultManager::transferToGpu(void *ptr, void *device) {
@@ -34,11 +34,49 @@ void PageFaultManager::transferToGpu(void *ptr, void *device) {
     auto ret =
         deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
                                                              allocData->cpuAllocation,
-                                                             allocData->size, false);
+                                                             0, allocData->size, false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
 }
+void PageFaultManager::transferChunkToCpu(void *allocPtr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
+                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                             offset, size, true);
+    UNRECOVERABLE_IF(ret);
+}
+void PageFaultManager::transferChunkToGpu(void *allocPtr, size_t offset, size_t size, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(allocPtr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    auto ret =
+        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                             allocData->cpuAllocation,
+                                                             offset, size, false);
+    UNRECOVERABLE_IF(ret);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
+}
+void PageFaultManager::discardCpuCopy(void *ptr, void *device) {
+    L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
+
+    NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    UNRECOVERABLE_IF(allocData == nullptr);
+
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
+}
+void PageFaultManager::finishTransfersToGpu() {
+    // page fault copies are executed synchronously on the immediate command list
+    this->pendingTransfersToGpu.clear();
+}
 } // namespace NEO
 
 namespace L0 {
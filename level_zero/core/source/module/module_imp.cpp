@@ -27,6 +27,7 @@
 #include "level_zero/core/source/module/module_build_log.h"
 
 #include "compiler_options.h"
+#include "config.h"
 #include "program_debug_data.h"
 
 #include <memory>
@@ -131,6 +132,9 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
     inputArgs.specializedValues = this->specConstantsValues;
+    //cached entries hold device binary only, debug data has to come from the compiler
+    bool debugDataRequired = (nullptr != device->getNEODevice()->getDebugger()) || NEO::CompilerOptions::contains(options, NEO::CompilerOptions::generateDebugInfo);
+    inputArgs.allowCaching = clCacheEnabled && !debugDataRequired;
     NEO::TranslationOutput compilerOuput = {};
     auto compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
@@ -553,6 +553,72 @@ TEST_F(CommandListMemAdvisePageFault, givenValidPtrAndPageFaultHandlerAndGpuDoma
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListMemAdvisePageFault, givenSharedAllocTrackedByPageFaultManagerWhenAppendMemoryPrefetchThenAllocIsMovedToGpuDomain) {
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    auto res = context->allocSharedMem(device->toHandle(),
+                                       &deviceDesc,
+                                       &hostDesc,
+                                       size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    mockPageFaultManager->insertAllocation(ptr, size, device->getDriverHandle()->getSvmAllocsManager(), device, {});
+    EXPECT_EQ(NEO::PageFaultManager::AllocationDomain::Cpu, mockPageFaultManager->memoryData.at(ptr).domain);
+
+    res = commandList->appendMemoryPrefetch(ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1, mockPageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(1, mockPageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(NEO::PageFaultManager::AllocationDomain::Gpu, mockPageFaultManager->memoryData.at(ptr).domain);
+
+    mockPageFaultManager->removeAllocation(ptr);
+    res = context->freeMem(ptr);
+    ASSERT_EQ(res, ZE_RESULT_SUCCESS);
+}
+
+TEST_F(CommandListMemAdvisePageFault, givenSharedAllocTrackedByPageFaultManagerWhenAppendMemAdviseWithDevicePreferredLocationThenAllocIsMovedToGpuDomain) {
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    auto res = context->allocSharedMem(device->toHandle(),
+                                       &deviceDesc,
+                                       &hostDesc,
+                                       size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    mockPageFaultManager->insertAllocation(ptr, size, device->getDriverHandle()->getSvmAllocsManager(), device, {});
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_READ_MOSTLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(0, mockPageFaultManager->transferToGpuCalled);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1, mockPageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(NEO::PageFaultManager::AllocationDomain::Gpu, mockPageFaultManager->memoryData.at(ptr).domain);
+
+    mockPageFaultManager->removeAllocation(ptr);
+    res = context->freeMem(ptr);
+    ASSERT_EQ(res, ZE_RESULT_SUCCESS);
+}
+
 TEST_F(CommandListMemAdvisePageFault, givenValidPtrAndPageFaultHandlerAndGpuDomainHandlerWithHintsSetAndInvalidHintsThenHandlerAllowsCpuMigration) {
     size_t size = 10;
     size_t alignment = 1u;
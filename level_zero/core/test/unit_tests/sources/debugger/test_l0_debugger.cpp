@@ -1112,7 +1112,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionEnabledCommandList
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::System4KBPages);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
@@ -1135,7 +1135,7 @@ HWTEST2_F(L0DebuggerSimpleTest, givenUseCsrImmediateSubmissionDisabledCommandLis
                                    reinterpret_cast<void *>(0x2345), size, 0, sizeof(uint32_t),
                                    MemoryPool::System4KBPages);
 
-    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0x100, false);
+    auto result = commandList->appendPageFaultCopy(&dstPtr, &srcPtr, 0, 0x100, false);
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 
     commandList->destroy();
@@ -24,6 +24,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include "config.h"
+
 using ::testing::Return;
 
 namespace L0 {
@@ -1347,6 +1349,21 @@ HWTEST_F(ModuleTranslationUnitTest, givenSystemSharedAllocationAllowedWhenBuildi
     }
 }
 
+HWTEST_F(ModuleTranslationUnitTest, givenDebugInfoRequestedInBuildOptionsWhenBuildingFromSpirVThenCompilerCacheIsNotUsed) {
+    auto mockCompilerInterface = new NEO::MockCompilerInterfaceCaptureBuildOptions;
+    auto &rootDeviceEnvironment = neoDevice->executionEnvironment->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(mockCompilerInterface);
+
+    MockModuleTranslationUnit moduleTu(device);
+    moduleTu.buildFromSpirV("", 0U, nullptr, "", nullptr);
+    EXPECT_EQ(clCacheEnabled, mockCompilerInterface->allowCaching);
+
+    mockCompilerInterface->allowCaching = true;
+    MockModuleTranslationUnit moduleTuWithDebugInfo(device);
+    moduleTuWithDebugInfo.buildFromSpirV("", 0U, NEO::CompilerOptions::generateDebugInfo.data(), "", nullptr);
+    EXPECT_FALSE(mockCompilerInterface->allowCaching);
+}
+
 using PrintfModuleTest = Test<DeviceFixture>;
 
 HWTEST_F(PrintfModuleTest, GivenModuleWithPrintfWhenKernelIsCreatedThenPrintfAllocationIsPlacedInResidencyContainer) {
@@ -1533,8 +1533,7 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
         retVal = Program::processInputDevices(deviceVectorPtr, numDevices, deviceList, pProgram->getDevices());
     }
     if (CL_SUCCESS == retVal) {
-        retVal = pProgram->build(*deviceVectorPtr, options, clCacheEnabled);
-        pProgram->invokeCallback(funcNotify, userData);
+        retVal = pProgram->buildAndNotify(*deviceVectorPtr, options, clCacheEnabled, funcNotify, userData);
     }
 
     TRACING_EXIT(clBuildProgram, &retVal);
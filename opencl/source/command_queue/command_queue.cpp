@@ -721,6 +721,20 @@ bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
 
+void CommandQueue::flushOutOfCsrDependencies(cl_uint numEventsInWaitList, const cl_event *eventWaitList, const CommandStreamReceiver &csr) {
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto event = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (event->isUserEvent() || event->getCommandQueue() == nullptr) {
+            continue;
+        }
+        //batched submissions of other csr have to reach HW before we wait for them
+        auto &eventCsr = event->getCommandQueue()->getGpgpuCommandStreamReceiver();
+        if (&eventCsr != &csr && eventCsr.isBatchedDispatchMode()) {
+            event->tryFlushEvent();
+        }
+    }
+}
+
 bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     auto blitterSupported = bcsEngine != nullptr;
 
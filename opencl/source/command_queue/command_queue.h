@@ -353,6 +353,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
+    void flushOutOfCsrDependencies(cl_uint numEventsInWaitList, const cl_event *eventWaitList, const CommandStreamReceiver &csr);
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
     bool blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOpParams &builtinOpParams) const;
     MOCKABLE_VIRTUAL bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region, const Image &image);
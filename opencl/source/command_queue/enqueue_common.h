@@ -166,15 +166,40 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     TagNodeBase *hwTimeStamps = nullptr;
 
-    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
-
+    //event setup and timestamp packet estimation are done before taking csr ownership, command programming below still needs it
     EventBuilder eventBuilder;
     setupEvent(eventBuilder, event, commandType);
 
     bool isMarkerWithProfiling = (CL_COMMAND_MARKER == commandType) && (eventBuilder.getEvent() && eventBuilder.getEvent()->isProfilingEnabled());
+    bool enqueueWithBlitAuxTranslation = isBlitAuxTranslationRequired(multiDispatchInfo);
+
+    size_t timestampPacketNodesCount = 0u;
+    if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        if (isCacheFlushCommand(commandType) || isMarkerWithProfiling) {
+            timestampPacketNodesCount = 1;
+        } else if (!multiDispatchInfo.empty()) {
+            timestampPacketNodesCount = estimateTimestampPacketNodesCount(multiDispatchInfo);
+        }
+    }
+
+    //printf surface is allocated and initialized here, it is patched into the kernel under csr ownership
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+    if (printfHandler) {
+        printfHandler->allocateSurface();
+    }
+    FileLoggerInstance().dumpKernelArgs(&multiDispatchInfo);
+
+    if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
+        blocking = true;
+    }
+
+    if (getGpgpuCommandStreamReceiver().isBatchedDispatchMode()) {
+        flushOutOfCsrDependencies(numEventsInWaitList, eventWaitList, getGpgpuCommandStreamReceiver());
+    }
+
+    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
     std::unique_ptr<KernelOperation> blockedCommandsData;
-    std::unique_ptr<PrintfHandler> printfHandler;
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
 
     auto blockQueue = false;
@@ -193,10 +218,6 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     bool clearAllDependencies = (queueDependenciesClearRequired() || clearDependenciesForSubCapture);
 
-    if (DebugManager.flags.MakeEachEnqueueBlocking.get()) {
-        blocking = true;
-    }
-
     TimestampPacketDependencies timestampPacketDependencies;
     EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
     CsrDependencies csrDeps;
@@ -206,8 +227,6 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         eventsRequest.fillCsrDependenciesForTaskCountContainer(csrDeps, getGpgpuCommandStreamReceiver());
     }
 
-    bool enqueueWithBlitAuxTranslation = isBlitAuxTranslationRequired(multiDispatchInfo);
-
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         if (!clearDependenciesForSubCapture) {
             eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
@@ -215,20 +234,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
         auto allocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
 
-        size_t nodesCount = 0u;
-        if (isCacheFlushCommand(commandType) || isMarkerWithProfiling) {
-            nodesCount = 1;
-        } else if (!multiDispatchInfo.empty()) {
-            nodesCount = estimateTimestampPacketNodesCount(multiDispatchInfo);
-        }
-
         if (isCacheFlushForBcsRequired() && enqueueWithBlitAuxTranslation) {
             // Cache flush for aux translation is always required (if supported)
             timestampPacketDependencies.cacheFlushNodes.add(allocator->getTag());
         }
 
-        if (nodesCount > 0) {
-            obtainNewTimestampPacketNodes(nodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies, getGpgpuCommandStreamReceiver());
+        if (timestampPacketNodesCount > 0) {
+            obtainNewTimestampPacketNodes(timestampPacketNodesCount, timestampPacketDependencies.previousEnqueueNodes, clearAllDependencies, getGpgpuCommandStreamReceiver());
             csrDeps.timestampPacketContainer.push_back(&timestampPacketDependencies.previousEnqueueNodes);
         }
     }
@@ -428,9 +440,7 @@ void CommandQueueHw<GfxFamily>::processDispatchForKernels(const MultiDispatchInf
                                                           KernelOperation *blockedCommandsData,
                                                           TimestampPacketDependencies &timestampPacketDependencies) {
     TagNodeBase *hwPerfCounter = nullptr;
-    FileLoggerInstance().dumpKernelArgs(&multiDispatchInfo);
 
-    printfHandler.reset(PrintfHandler::create(multiDispatchInfo, *device));
     if (printfHandler) {
         printfHandler->prepareDispatch(multiDispatchInfo);
     }
@@ -1163,8 +1173,10 @@ size_t CommandQueueHw<GfxFamily>::calculateHostPtrSizeForImage(const size_t *reg
 template <typename GfxFamily>
 template <uint32_t cmdType>
 void CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking) {
-    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
     auto &bcsCsr = *getBcsCommandStreamReceiver();
+    flushOutOfCsrDependencies(numEventsInWaitList, eventWaitList, bcsCsr);
+
+    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
     EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
     EventBuilder eventBuilder;
@@ -517,6 +517,33 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMigrateMem(cl_uint numSvmPointers,
                                                eventWaitList,
                                                event);
 
+    // transitions run right away on the context's queue, so they are skipped while the migration still waits for
+    // other work, such allocations are migrated by the next page fault or kernel enqueue instead
+    bool dependenciesCompleted = (false == isQueueBlocked());
+    for (cl_uint i = 0; dependenciesCompleted && (i < numEventsInWaitList); i++) {
+        dependenciesCompleted = castToObjectOrAbort<Event>(eventWaitList[i])->updateStatusAndCheckCompletion();
+    }
+
+    auto memoryManager = context->getMemoryManager();
+    auto pageFaultManager = memoryManager->getPageFaultManager();
+    if (pageFaultManager && dependenciesCompleted) {
+        for (cl_uint i = 0; i < numSvmPointers; i++) {
+            auto svmData = context->getSVMAllocsManager()->getSVMAlloc(svmPointers[i]);
+            if (svmData == nullptr) {
+                continue;
+            }
+            auto gpuAllocation = svmData->gpuAllocations.getGraphicsAllocation(getDevice().getRootDeviceIndex());
+            if (flags & CL_MIGRATE_MEM_OBJECT_HOST) {
+                if (memoryManager->allocInUse(*gpuAllocation)) {
+                    continue;
+                }
+                pageFaultManager->moveAllocationToCpuDomain(const_cast<void *>(svmPointers[i]));
+            } else {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(gpuAllocation->getGpuAddress()));
+            }
+        }
+    }
+
     return CL_SUCCESS;
 }
 } // namespace NEO
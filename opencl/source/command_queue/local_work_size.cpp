@@ -449,7 +449,20 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
 }
 
 Vec3<size_t> generateWorkgroupSize(const DispatchInfo &dispatchInfo) {
-    return (dispatchInfo.getEnqueuedWorkgroupSize().x == 0) ? computeWorkgroupSize(dispatchInfo) : dispatchInfo.getEnqueuedWorkgroupSize();
+    if (dispatchInfo.getEnqueuedWorkgroupSize().x != 0) {
+        return dispatchInfo.getEnqueuedWorkgroupSize();
+    }
+
+    auto kernel = dispatchInfo.getKernel();
+    Vec3<size_t> lws{0, 0, 0};
+    if (kernel && kernel->getCachedLocalWorkSize(dispatchInfo.getClDevice(), dispatchInfo.getGWS(), dispatchInfo.getDim(), lws)) {
+        return lws;
+    }
+    lws = computeWorkgroupSize(dispatchInfo);
+    if (kernel) {
+        kernel->cacheLocalWorkSize(dispatchInfo.getClDevice(), dispatchInfo.getGWS(), dispatchInfo.getDim(), lws);
+    }
+    return lws;
 }
 
 Vec3<size_t> computeWorkgroupsNumber(const Vec3<size_t> gws, const Vec3<size_t> lws) {
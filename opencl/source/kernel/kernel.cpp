@@ -1035,6 +1035,46 @@ void Kernel::getSuggestedLocalWorkSize(const cl_uint workDim, const size_t *glob
         localWorkSize[2] = suggestedLws.z;
 }
 
+bool Kernel::isLocalWorkSizeCacheEnabled() const {
+    //builtins may require limited workgroup size depending on their arguments
+    return DebugManager.flags.EnableLocalWorkSizeCache.get() != 0 && !isBuiltIn;
+}
+
+Kernel::LocalWorkSizeConfig Kernel::getLocalWorkSizeConfig(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim) const {
+    return {gws, workDim, slmTotalSize, device.getRootDeviceIndex(), device.getDeviceBitfield().to_ullong(),
+            DebugManager.flags.EnableComputeWorkSizeND.get(), DebugManager.flags.EnableComputeWorkSizeSquared.get()};
+}
+
+bool Kernel::getCachedLocalWorkSize(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, Vec3<size_t> &lws) {
+    if (!isLocalWorkSizeCacheEnabled()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(localWorkSizeCacheMutex);
+    auto it = localWorkSizeCache.find(getLocalWorkSizeConfig(device, gws, workDim));
+    if (it == localWorkSizeCache.end()) {
+        return false;
+    }
+    lws = it->second;
+    return true;
+}
+
+void Kernel::cacheLocalWorkSize(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, const Vec3<size_t> &lws) {
+    if (!isLocalWorkSizeCacheEnabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(localWorkSizeCacheMutex);
+    auto config = getLocalWorkSizeConfig(device, gws, workDim);
+    auto inserted = localWorkSizeCache.insert({config, lws}).second;
+    if (!inserted) {
+        return;
+    }
+    localWorkSizeCacheOrder.push_back(config);
+    if (localWorkSizeCacheOrder.size() > maxLocalWorkSizeCacheEntries) {
+        localWorkSizeCache.erase(localWorkSizeCacheOrder.front());
+        localWorkSizeCacheOrder.pop_front();
+    }
+}
+
 uint32_t Kernel::getMaxWorkGroupCount(const cl_uint workDim, const size_t *localWorkSize, const CommandQueue *commandQueue) const {
     auto &hardwareInfo = getHardwareInfo();
     auto &hwHelper = HwHelper::get(hardwareInfo.platform.eRenderCoreFamily);
@@ -28,6 +28,8 @@
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
 
+#include <deque>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -377,6 +379,10 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     void getSuggestedLocalWorkSize(const cl_uint workDim, const size_t *globalWorkSize, const size_t *globalWorkOffset,
                                    size_t *localWorkSize);
     uint32_t getMaxWorkGroupCount(const cl_uint workDim, const size_t *localWorkSize, const CommandQueue *commandQueue) const;
+    bool getCachedLocalWorkSize(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, Vec3<size_t> &lws);
+    void cacheLocalWorkSize(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, const Vec3<size_t> &lws);
+
+    static constexpr size_t maxLocalWorkSizeCacheEntries = 64u;
 
     uint64_t getKernelStartOffset(
         const bool localIdsGenerationByRuntime,
@@ -620,6 +626,37 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
 
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
+
+    struct LocalWorkSizeConfig {
+        Vec3<size_t> gws;
+        uint32_t workDim;
+        uint32_t slmTotalSize;
+        uint32_t rootDeviceIndex;
+        uint64_t deviceBitfield;
+        bool computeWorkSizeND;
+        bool computeWorkSizeSquared;
+        bool operator==(const LocalWorkSizeConfig &other) const {
+            return this->gws == other.gws && this->workDim == other.workDim && this->slmTotalSize == other.slmTotalSize &&
+                   this->rootDeviceIndex == other.rootDeviceIndex && this->deviceBitfield == other.deviceBitfield &&
+                   this->computeWorkSizeND == other.computeWorkSizeND && this->computeWorkSizeSquared == other.computeWorkSizeSquared;
+        }
+    };
+    struct LocalWorkSizeConfigHash {
+        size_t operator()(LocalWorkSizeConfig const &config) const {
+            auto hash = std::hash<size_t>{};
+            return (hash(config.gws.x) ^ (hash(config.gws.y) << 1u) ^ (hash(config.gws.z) << 2u)) ^
+                   (hash(config.workDim) << 3u) ^ (hash(config.slmTotalSize) << 4u) ^
+                   (hash(config.computeWorkSizeND) << 5u) ^ (hash(config.computeWorkSizeSquared) << 6u) ^
+                   (hash(config.rootDeviceIndex) << 7u) ^ (hash(static_cast<size_t>(config.deviceBitfield)) << 8u);
+        }
+    };
+    bool isLocalWorkSizeCacheEnabled() const;
+    LocalWorkSizeConfig getLocalWorkSizeConfig(const ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim) const;
+
+    //local work size selected by driver for given global work size, doesn't depend on kernel arguments other than slm
+    std::unordered_map<LocalWorkSizeConfig, Vec3<size_t>, LocalWorkSizeConfigHash> localWorkSizeCache;
+    std::deque<LocalWorkSizeConfig> localWorkSizeCacheOrder;
+    std::mutex localWorkSizeCacheMutex;
     bool singleSubdevicePreferredInCurrentEnqueue = false;
 
     bool kernelHasIndirectAccess = true;
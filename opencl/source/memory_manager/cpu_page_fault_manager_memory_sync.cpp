@@ -1,16 +1,19 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 
+#include <algorithm>
+
 namespace NEO {
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
@@ -22,10 +25,72 @@ void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
     memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
     auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
+    if (this->batchTransfersToGpu) {
+        this->pendingTransfersToGpu.push_back({ptr, cmdQ});
+        return;
+    }
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 
     auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
+void PageFaultManager::transferChunkToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptrOffset(allocPtr, offset), size, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+}
+void PageFaultManager::transferChunkToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto &pageFaultData = memoryData[allocPtr];
+    auto unifiedMemoryManager = pageFaultData.unifiedMemoryManager;
+    // drop per chunk map operations left by faults, the range is unmapped with a single copy
+    for (size_t chunkOffset = offset; chunkOffset < offset + size; chunkOffset += pageFaultData.chunkSize) {
+        auto chunkPtr = ptrOffset(allocPtr, chunkOffset);
+        if (unifiedMemoryManager->getSvmMapOperation(chunkPtr)) {
+            unifiedMemoryManager->removeSvmMapOperation(chunkPtr);
+        }
+    }
+    auto rangePtr = ptrOffset(allocPtr, offset);
+    unifiedMemoryManager->insertSvmMapOperation(rangePtr, size, allocPtr, offset, false);
+    auto retVal = commandQueue->enqueueSVMUnmap(rangePtr, 0, nullptr, nullptr, false);
+    UNRECOVERABLE_IF(retVal);
+    if (this->batchTransfersToGpu) {
+        if (this->pendingTransfersToGpu.empty() || this->pendingTransfersToGpu.back().allocPtr != allocPtr) {
+            this->pendingTransfersToGpu.push_back({allocPtr, cmdQ});
+        }
+        return;
+    }
+    retVal = commandQueue->finish();
+    UNRECOVERABLE_IF(retVal);
+
+    auto allocData = unifiedMemoryManager->getSVMAlloc(allocPtr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+void PageFaultManager::discardCpuCopy(void *ptr, void *cmdQ) {
+    auto commandQueue = static_cast<CommandQueue *>(cmdQ);
+    auto unifiedMemoryManager = memoryData[ptr].unifiedMemoryManager;
+    // map left by the prefetch would make the next fault skip copying data written by the GPU
+    if (unifiedMemoryManager->getSvmMapOperation(ptr)) {
+        unifiedMemoryManager->removeSvmMapOperation(ptr);
+    }
+    auto allocData = unifiedMemoryManager->getSVMAlloc(ptr);
+    this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+}
+void PageFaultManager::finishTransfersToGpu() {
+    std::vector<void *> finishedQueues;
+    for (auto &transfer : this->pendingTransfersToGpu) {
+        if (std::find(finishedQueues.begin(), finishedQueues.end(), transfer.cmdQ) == finishedQueues.end()) {
+            auto retVal = static_cast<CommandQueue *>(transfer.cmdQ)->finish();
+            UNRECOVERABLE_IF(retVal);
+            finishedQueues.push_back(transfer.cmdQ);
+        }
+    }
+    for (auto &transfer : this->pendingTransfersToGpu) {
+        auto commandQueue = static_cast<CommandQueue *>(transfer.cmdQ);
+        auto allocData = memoryData[transfer.allocPtr].unifiedMemoryManager->getSVMAlloc(transfer.allocPtr);
+        this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
+    }
+    this->pendingTransfersToGpu.clear();
+}
 } // namespace NEO
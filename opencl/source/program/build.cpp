@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/execution_environment/execution_environment.h"
@@ -33,178 +34,236 @@ cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions,
     bool enableCaching) {
-    cl_int retVal = CL_SUCCESS;
-    std::string internalOptions;
-    initInternalOptions(internalOptions);
+    BuildRequest request(deviceVector);
+    auto retVal = prepareBuild(request, buildOptions, enableCaching);
+    if (retVal == CL_INVALID_OPERATION) {
+        return retVal;
+    }
+    if (retVal == CL_SUCCESS) {
+        compileBuildRequest(request);
+        retVal = publishBuild(request);
+    }
+    if (retVal != CL_SUCCESS) {
+        setBuildStatusError(deviceVector);
+    }
+    return retVal;
+}
+
+cl_int Program::buildAndNotify(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                               void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    auto pCompilerInterface = deviceVector[0]->getDevice().getCompilerInterface();
+    //programs created from binary aren't compiled, there is nothing to offload
+    if ((nullptr == funcNotify) || (nullptr == pCompilerInterface) || isCreatedFromBinary || (DebugManager.flags.EnableAsyncProgramBuild.get() != 1)) {
+        auto retVal = build(deviceVector, buildOptions, enableCaching);
+        invokeCallback(funcNotify, userData);
+        return retVal;
+    }
+
+    auto request = std::make_shared<BuildRequest>(deviceVector);
+    auto retVal = prepareBuild(*request, buildOptions, enableCaching);
+    if (retVal == CL_INVALID_OPERATION) {
+        return retVal;
+    }
+    if (retVal != CL_SUCCESS) {
+        setBuildStatusError(deviceVector);
+        invokeCallback(funcNotify, userData);
+        return retVal;
+    }
+
+    this->incRefInternal();
+    pCompilerInterface->getBuildWorkerPool()->submit([this, request, funcNotify, userData]() {
+        compileBuildRequest(*request);
+        if (CL_SUCCESS != publishBuild(*request)) {
+            setBuildStatusError(request->deviceVector);
+        }
+        invokeCallback(funcNotify, userData);
+        decRefInternal();
+    });
+    return CL_SUCCESS;
+}
+
+cl_int Program::prepareBuild(BuildRequest &request, const char *buildOptions, bool enableCaching) {
+    TakeOwnershipWrapper<Program> programOwnership(*this);
+    auto &deviceVector = request.deviceVector;
     auto defaultClDevice = deviceVector[0];
     UNRECOVERABLE_IF(defaultClDevice == nullptr);
     auto &defaultDevice = defaultClDevice->getDevice();
 
-    enum class BuildPhase {
-        Init,
-        SourceCodeNotification,
-        BinaryCreation,
-        BinaryProcessing,
-        DebugDataNotification
-    };
-
-    std::unordered_map<uint32_t, BuildPhase> phaseReached;
     for (const auto &clDevice : deviceVector) {
-        phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::Init;
+        request.phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::Init;
     }
-    do {
-        // check to see if a previous build request is in progress
-        if (std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
-            retVal = CL_INVALID_OPERATION;
-            break;
-        }
 
-        if (isCreatedFromBinary == false) {
-            for (const auto &device : deviceVector) {
-                deviceBuildInfos[device].buildStatus = CL_BUILD_IN_PROGRESS;
-            }
+    // check to see if a previous build request is in progress
+    if (std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
+        return CL_INVALID_OPERATION;
+    }
 
-            if (nullptr != buildOptions) {
-                options = buildOptions;
-            } else if (this->createdFrom != CreatedFrom::BINARY) {
-                options = "";
-            }
-            extractInternalOptions(options, internalOptions);
-            applyAdditionalOptions(internalOptions);
+    if (isCreatedFromBinary) {
+        return CL_SUCCESS;
+    }
 
-            CompilerInterface *pCompilerInterface = defaultDevice.getCompilerInterface();
-            if (!pCompilerInterface) {
-                retVal = CL_OUT_OF_HOST_MEMORY;
-                break;
-            }
+    for (const auto &device : deviceVector) {
+        deviceBuildInfos[device].buildStatus = CL_BUILD_IN_PROGRESS;
+    }
 
-            TranslationInput inputArgs = {IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
-            if (createdFrom != CreatedFrom::SOURCE) {
-                inputArgs.srcType = isSpirV ? IGC::CodeType::spirV : IGC::CodeType::llvmBc;
-                inputArgs.src = ArrayRef<const char>(irBinary.get(), irBinarySize);
-            } else {
-                inputArgs.src = ArrayRef<const char>(sourceCode.c_str(), sourceCode.size());
-            }
+    auto &internalOptions = request.internalOptions;
+    initInternalOptions(internalOptions);
+    if (nullptr != buildOptions) {
+        options = buildOptions;
+    } else if (this->createdFrom != CreatedFrom::BINARY) {
+        options = "";
+    }
+    extractInternalOptions(options, internalOptions);
+    applyAdditionalOptions(internalOptions);
 
-            if (inputArgs.src.size() == 0) {
-                retVal = CL_INVALID_PROGRAM;
-                break;
-            }
+    request.compilerInterface = defaultDevice.getCompilerInterface();
+    if (!request.compilerInterface) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
 
-            if (isKernelDebugEnabled()) {
-                std::string filename;
-                for (const auto &clDevice : deviceVector) {
-                    if (BuildPhase::SourceCodeNotification == phaseReached[clDevice->getRootDeviceIndex()]) {
-                        continue;
-                    }
-                    appendKernelDebugOptions(*clDevice, internalOptions);
-                    notifyDebuggerWithSourceCode(*clDevice, filename);
-                    prependFilePathToOptions(filename);
-
-                    phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::SourceCodeNotification;
-                }
-            }
+    auto &inputArgs = request.inputArgs;
+    if (createdFrom != CreatedFrom::SOURCE) {
+        inputArgs.srcType = isSpirV ? IGC::CodeType::spirV : IGC::CodeType::llvmBc;
+        inputArgs.src = ArrayRef<const char>(irBinary.get(), irBinarySize);
+    } else {
+        inputArgs.src = ArrayRef<const char>(sourceCode.c_str(), sourceCode.size());
+    }
 
-            std::string extensions = requiresOpenClCFeatures(options) ? defaultClDevice->peekCompilerExtensionsWithFeatures()
-                                                                      : defaultClDevice->peekCompilerExtensions();
-            if (requiresAdditionalExtensions(options)) {
-                extensions.erase(extensions.length() - 1);
-                extensions += ",+cl_khr_3d_image_writes ";
-            }
-            CompilerOptions::concatenateAppend(internalOptions, extensions);
-
-            inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
-            inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
-            inputArgs.GTPinInput = gtpinGetIgcInit();
-            inputArgs.specializedValues = this->specConstantsValues;
-            DBG_LOG(LogApiCalls,
-                    "Build Options", inputArgs.apiOptions.begin(),
-                    "\nBuild Internal Options", inputArgs.internalOptions.begin());
-            inputArgs.allowCaching = enableCaching;
-            NEO::TranslationOutput compilerOuput = {};
-
-            for (const auto &clDevice : deviceVector) {
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
-                retVal = asClError(compilerErr);
-                if (retVal != CL_SUCCESS) {
-                    break;
-                }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
-                    this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
-                    this->irBinarySize = compilerOuput.intermediateRepresentation.size;
-                    this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
-                }
-                if (BuildPhase::BinaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
-                    continue;
-                }
-                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
-                phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
-            }
-            if (retVal != CL_SUCCESS) {
-                break;
-            }
-            this->debugData = std::move(compilerOuput.debugData.mem);
-            this->debugDataSize = compilerOuput.debugData.size;
-        }
-        updateNonUniformFlag();
+    if (inputArgs.src.size() == 0) {
+        return CL_INVALID_PROGRAM;
+    }
 
-        for (auto &clDevice : deviceVector) {
-            if (BuildPhase::BinaryProcessing == phaseReached[clDevice->getRootDeviceIndex()]) {
+    if (isKernelDebugEnabled()) {
+        std::string filename;
+        for (const auto &clDevice : deviceVector) {
+            if (BuildPhase::SourceCodeNotification == request.phaseReached[clDevice->getRootDeviceIndex()]) {
                 continue;
             }
-            if (DebugManager.flags.PrintProgramBinaryProcessingTime.get()) {
-                retVal = TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, *clDevice);
-            } else {
-                retVal = processGenBinary(*clDevice);
-            }
+            appendKernelDebugOptions(*clDevice, internalOptions);
+            notifyDebuggerWithSourceCode(*clDevice, filename);
+            prependFilePathToOptions(filename);
 
-            if (retVal != CL_SUCCESS) {
-                break;
-            }
-            phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryProcessing;
+            request.phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::SourceCodeNotification;
         }
+    }
 
-        if (retVal != CL_SUCCESS) {
+    std::string extensions = requiresOpenClCFeatures(options) ? defaultClDevice->peekCompilerExtensionsWithFeatures()
+                                                              : defaultClDevice->peekCompilerExtensions();
+    if (requiresAdditionalExtensions(options)) {
+        extensions.erase(extensions.length() - 1);
+        extensions += ",+cl_khr_3d_image_writes ";
+    }
+    CompilerOptions::concatenateAppend(internalOptions, extensions);
+
+    request.apiOptions = options;
+    inputArgs.apiOptions = ArrayRef<const char>(request.apiOptions.c_str(), request.apiOptions.length());
+    inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
+    inputArgs.GTPinInput = gtpinGetIgcInit();
+    inputArgs.specializedValues = this->specConstantsValues;
+    DBG_LOG(LogApiCalls,
+            "Build Options", inputArgs.apiOptions.begin(),
+            "\nBuild Internal Options", inputArgs.internalOptions.begin());
+    inputArgs.allowCaching = enableCaching;
+    kernelDescriptorsCache = (enableCaching && DebugManager.flags.EnableKernelDescriptorsCache.get() != 0) ? request.compilerInterface->getCache() : nullptr;
+    return CL_SUCCESS;
+}
+
+void Program::compileBuildRequest(BuildRequest &request) {
+    if (nullptr == request.compilerInterface) {
+        return;
+    }
+    for (const auto &clDevice : request.deviceVector) {
+        request.compilerOutputs.emplace_back();
+        auto compilerErr = request.compilerInterface->build(clDevice->getDevice(), request.inputArgs, request.compilerOutputs.back());
+        request.compilerErrors.push_back(compilerErr);
+        if (compilerErr != TranslationOutput::ErrorCode::Success) {
             break;
         }
+    }
+}
 
-        if (isKernelDebugEnabled() || gtpinIsGTPinInitialized()) {
+cl_int Program::publishBuild(BuildRequest &request) {
+    TakeOwnershipWrapper<Program> programOwnership(*this);
+    cl_int retVal = CL_SUCCESS;
+    auto &deviceVector = request.deviceVector;
+    auto &phaseReached = request.phaseReached;
+
+    for (auto i = 0u; i < request.compilerOutputs.size(); i++) {
+        auto clDevice = deviceVector[i];
+        auto &compilerOuput = request.compilerOutputs[i];
+        this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
+        this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
+        retVal = asClError(request.compilerErrors[i]);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+        if (request.inputArgs.srcType == IGC::CodeType::oclC) {
+            this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
+            this->irBinarySize = compilerOuput.intermediateRepresentation.size;
+            this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
+        }
+        if (BuildPhase::BinaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
+            continue;
+        }
+        this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
+        phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
+    }
+    if (false == request.compilerOutputs.empty()) {
+        this->debugData = std::move(request.compilerOutputs.back().debugData.mem);
+        this->debugDataSize = request.compilerOutputs.back().debugData.size;
+    }
+    updateNonUniformFlag();
 
-            for (auto &clDevice : deviceVector) {
-                auto rootDeviceIndex = clDevice->getRootDeviceIndex();
-                if (BuildPhase::DebugDataNotification == phaseReached[rootDeviceIndex]) {
-                    continue;
-                }
-                processDebugData(rootDeviceIndex);
-                if (clDevice->getSourceLevelDebugger()) {
-                    for (auto kernelInfo : buildInfos[rootDeviceIndex].kernelInfoArray) {
-                        clDevice->getSourceLevelDebugger()->notifyKernelDebugData(&kernelInfo->debugData,
-                                                                                  kernelInfo->kernelDescriptor.kernelMetadata.kernelName,
-                                                                                  kernelInfo->heapInfo.pKernelHeap,
-                                                                                  kernelInfo->heapInfo.KernelHeapSize);
-                    }
-                }
-                phaseReached[rootDeviceIndex] = BuildPhase::DebugDataNotification;
-            }
+    for (auto &clDevice : deviceVector) {
+        if (BuildPhase::BinaryProcessing == phaseReached[clDevice->getRootDeviceIndex()]) {
+            continue;
+        }
+        if (DebugManager.flags.PrintProgramBinaryProcessingTime.get()) {
+            retVal = TimeMeasureWrapper::functionExecution(*this, &Program::processGenBinary, *clDevice);
+        } else {
+            retVal = processGenBinary(*clDevice);
         }
 
-        for (const auto &device : deviceVector) {
-            separateBlockKernels(device->getRootDeviceIndex());
+        if (retVal != CL_SUCCESS) {
+            return retVal;
         }
-    } while (false);
+        phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryProcessing;
+    }
 
-    if (retVal != CL_SUCCESS) {
-        for (const auto &device : deviceVector) {
-            deviceBuildInfos[device].buildStatus = CL_BUILD_ERROR;
-            deviceBuildInfos[device].programBinaryType = CL_PROGRAM_BINARY_TYPE_NONE;
+    if (isKernelDebugEnabled() || gtpinIsGTPinInitialized()) {
+
+        for (auto &clDevice : deviceVector) {
+            auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+            if (BuildPhase::DebugDataNotification == phaseReached[rootDeviceIndex]) {
+                continue;
+            }
+            processDebugData(rootDeviceIndex);
+            if (clDevice->getSourceLevelDebugger()) {
+                for (auto kernelInfo : buildInfos[rootDeviceIndex].kernelInfoArray) {
+                    clDevice->getSourceLevelDebugger()->notifyKernelDebugData(&kernelInfo->debugData,
+                                                                              kernelInfo->kernelDescriptor.kernelMetadata.kernelName,
+                                                                              kernelInfo->heapInfo.pKernelHeap,
+                                                                              kernelInfo->heapInfo.KernelHeapSize);
+                }
+            }
+            phaseReached[rootDeviceIndex] = BuildPhase::DebugDataNotification;
         }
-    } else {
-        setBuildStatusSuccess(deviceVector, CL_PROGRAM_BINARY_TYPE_EXECUTABLE);
     }
 
-    return retVal;
+    for (const auto &device : deviceVector) {
+        separateBlockKernels(device->getRootDeviceIndex());
+    }
+
+    setBuildStatusSuccess(deviceVector, CL_PROGRAM_BINARY_TYPE_EXECUTABLE);
+    return CL_SUCCESS;
+}
+
+void Program::setBuildStatusError(const ClDeviceVector &deviceVector) {
+    TakeOwnershipWrapper<Program> programOwnership(*this);
+    for (const auto &device : deviceVector) {
+        deviceBuildInfos[device].buildStatus = CL_BUILD_ERROR;
+        deviceBuildInfos[device].programBinaryType = CL_PROGRAM_BINARY_TYPE_NONE;
+    }
 }
 
 bool Program::appendKernelDebugOptions(ClDevice &clDevice, std::string &internalOptions) {
@@ -184,11 +184,16 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
 
     auto pClDev = castToObject<ClDevice>(device);
     auto rootDeviceIndex = pClDev->getRootDeviceIndex();
+    cl_build_status buildStatus = CL_BUILD_NONE;
+
+    //build results are published under program ownership
+    TakeOwnershipWrapper<const Program> programOwnership(*this, paramName != CL_PROGRAM_BUILD_STATUS);
 
     switch (paramName) {
     case CL_PROGRAM_BUILD_STATUS:
+        buildStatus = deviceBuildInfos.at(pClDev).buildStatus;
         srcSize = retSize = sizeof(cl_build_status);
-        pSrc = &deviceBuildInfos.at(pClDev).buildStatus;
+        pSrc = &buildStatus;
         break;
 
     case CL_PROGRAM_BUILD_OPTIONS:
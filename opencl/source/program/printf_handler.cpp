@@ -43,13 +43,12 @@ PrintfHandler *PrintfHandler::create(const MultiDispatchInfo &multiDispatchInfo,
     return nullptr;
 }
 
-void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo) {
+void PrintfHandler::allocateSurface() {
     auto printfSurfaceSize = device.getSharedDeviceInfo().printfBufferSize;
-    if (printfSurfaceSize == 0) {
+    if ((printfSurfaceSize == 0) || (printfSurface != nullptr)) {
         return;
     }
     auto rootDeviceIndex = device.getRootDeviceIndex();
-    kernel = multiDispatchInfo.peekMainKernel();
     printfSurface = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, printfSurfaceSize, GraphicsAllocation::AllocationType::PRINTF_SURFACE, device.getDeviceBitfield()});
 
     auto &hwInfo = device.getHardwareInfo();
@@ -58,6 +57,14 @@ void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo)
     MemoryTransferHelper::transferMemoryToAllocation(helper.isBlitCopyRequiredForLocalMemory(hwInfo, *printfSurface),
                                                      device.getDevice(), printfSurface, 0, printfSurfaceInitialDataSizePtr.get(),
                                                      sizeof(*printfSurfaceInitialDataSizePtr.get()));
+}
+
+void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo) {
+    allocateSurface();
+    if (printfSurface == nullptr) {
+        return;
+    }
+    kernel = multiDispatchInfo.peekMainKernel();
 
     const auto &printfSurfaceArg = kernel->getKernelInfo().kernelDescriptor.payloadMappings.implicitArgs.printfSurfaceAddress;
     auto printfPatchAddress = ptrOffset(reinterpret_cast<uintptr_t *>(kernel->getCrossThreadData()), printfSurfaceArg.stateless);
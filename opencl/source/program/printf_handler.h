@@ -22,6 +22,7 @@ class PrintfHandler {
 
     ~PrintfHandler();
 
+    void allocateSurface();
     void prepareDispatch(const MultiDispatchInfo &multiDispatchInfo);
     void makeResident(CommandStreamReceiver &commandStreamReceiver);
     void printEnqueueOutput();
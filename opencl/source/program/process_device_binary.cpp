@@ -5,7 +5,9 @@
  *
  */
 
+#include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/zebin_kernel_descriptors_cache.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -150,9 +152,34 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
     std::string decodeErrors;
     std::string decodeWarnings;
 
-    DecodeError decodeError;
-    DeviceBinaryFormat singleDeviceBinaryFormat;
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+    DecodeError decodeError = DecodeError::InvalidBinary;
+    DeviceBinaryFormat singleDeviceBinaryFormat = DeviceBinaryFormat::Unknown;
+    std::string kernelDescriptorsCacheEntry;
+    if ((nullptr != kernelDescriptorsCache) && isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(blob)) {
+        kernelDescriptorsCacheEntry = ZebinKernelDescriptorsCache::getCacheEntryName(blob);
+        size_t cachedSize = 0U;
+        auto cached = kernelDescriptorsCache->loadCachedBinary(kernelDescriptorsCacheEntry, cachedSize);
+        if (nullptr != cached) {
+            auto serialized = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(cached.get()), cachedSize);
+            std::string cacheErrors;
+            std::string cacheWarnings;
+            if (DecodeError::Success == ZebinKernelDescriptorsCache::deserialize(programInfo, binary, serialized, cacheErrors, cacheWarnings)) {
+                decodeError = DecodeError::Success;
+                singleDeviceBinaryFormat = DeviceBinaryFormat::Zebin;
+                decodeWarnings = std::move(cacheWarnings);
+            }
+        }
+    }
+
+    if (DecodeError::Success != decodeError) {
+        std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+
+        std::vector<uint8_t> serialized;
+        if ((false == kernelDescriptorsCacheEntry.empty()) && (DecodeError::Success == decodeError) &&
+            ZebinKernelDescriptorsCache::serialize(programInfo, blob, decodeWarnings, serialized)) {
+            kernelDescriptorsCache->cacheBinary(kernelDescriptorsCacheEntry, reinterpret_cast<const char *>(serialized.data()), static_cast<uint32_t>(serialized.size()));
+        }
+    }
 
     if (isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(binary.deviceBinary)) {
         NEO::LinkerInput::SectionNameToSegmentIdMap nameToKernelId;
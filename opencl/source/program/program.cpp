@@ -52,7 +52,7 @@ Program::Program(Context *context, bool isBuiltIn, const ClDeviceVector &clDevic
         if (device->getRootDeviceIndex() > maxRootDeviceIndex) {
             maxRootDeviceIndex = device->getRootDeviceIndex();
         }
-        deviceBuildInfos[device] = {};
+        deviceBuildInfos.try_emplace(device);
         if (device->getNumGenericSubDevices() > 1) {
             for (auto i = 0u; i < device->getNumGenericSubDevices(); i++) {
                 auto subDevice = device->getNearestGenericSubDevice(i);
@@ -473,6 +473,7 @@ cl_int Program::packDeviceBinary(ClDevice &clDevice) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = packedDeviceBinary.size();
     } else if (nullptr != this->irBinary.get()) {
         NEO::Elf::ElfEncoder<> elfEncoder(true, true, 1U);
+        elfEncoder.setReferenceExternalData(true);
         if (deviceBuildInfos[&clDevice].programBinaryType == CL_PROGRAM_BINARY_TYPE_LIBRARY) {
             elfEncoder.getElfFileHeader().type = NEO::Elf::ET_OPENCL_LIBRARY;
         } else {
@@ -480,9 +481,11 @@ cl_int Program::packDeviceBinary(ClDevice &clDevice) {
         }
         elfEncoder.appendSection(NEO::Elf::SHT_OPENCL_SPIRV, NEO::Elf::SectionNamesOpenCl::spirvObject, ArrayRef<const uint8_t>::fromAny(this->irBinary.get(), this->irBinarySize));
         elfEncoder.appendSection(NEO::Elf::SHT_OPENCL_OPTIONS, NEO::Elf::SectionNamesOpenCl::buildOptions, this->options);
-        auto elfData = elfEncoder.encode();
-        this->buildInfos[rootDeviceIndex].packedDeviceBinary = makeCopy(elfData.data(), elfData.size());
-        this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = elfData.size();
+        auto elfSize = elfEncoder.getEncodedSize();
+        auto elfData = std::make_unique<char[]>(elfSize);
+        elfEncoder.encode(ArrayRef<uint8_t>(reinterpret_cast<uint8_t *>(elfData.get()), elfSize));
+        this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(elfData);
+        this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = elfSize;
     } else {
         return CL_INVALID_PROGRAM;
     }
@@ -20,6 +20,7 @@
 #include "cif/builtins/memory/buffer/buffer.h"
 #include "patch_list.h"
 
+#include <atomic>
 #include <list>
 #include <string>
 #include <vector>
@@ -32,6 +33,7 @@ struct ProgramFromPatchtokens;
 class BlockKernelManager;
 class BuiltinDispatchInfoBuilder;
 class ClDevice;
+class CompilerCache;
 class Context;
 class CompilerInterface;
 class Device;
@@ -131,6 +133,9 @@ class Program : public BaseObject<_cl_program> {
     cl_int build(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
                  std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> &builtinsMap);
 
+    cl_int buildAndNotify(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                          void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+
     MOCKABLE_VIRTUAL cl_int processGenBinary(const ClDevice &clDevice);
     MOCKABLE_VIRTUAL cl_int processProgramInfo(ProgramInfo &dst, const ClDevice &clDevice);
 
@@ -154,7 +159,7 @@ class Program : public BaseObject<_cl_program> {
                         size_t paramValueSize, void *paramValue, size_t *paramValueSizeRet) const;
 
     bool isBuilt() const {
-        return std::any_of(this->deviceBuildInfos.begin(), this->deviceBuildInfos.end(), [](auto deviceBuildInfo) { return deviceBuildInfo.second.buildStatus == CL_SUCCESS && deviceBuildInfo.second.programBinaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE; });
+        return std::any_of(this->deviceBuildInfos.begin(), this->deviceBuildInfos.end(), [](const auto &deviceBuildInfo) { return deviceBuildInfo.second.buildStatus == CL_SUCCESS && deviceBuildInfo.second.programBinaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE; });
     }
 
     Context &getContext() const {
@@ -283,6 +288,33 @@ class Program : public BaseObject<_cl_program> {
     }
 
   protected:
+    enum class BuildPhase {
+        Init,
+        SourceCodeNotification,
+        BinaryCreation,
+        BinaryProcessing,
+        DebugDataNotification
+    };
+
+    //compiler inputs and outputs of a single build, compilation doesn't touch program state
+    struct BuildRequest {
+        BuildRequest(const ClDeviceVector &deviceVector) : deviceVector(deviceVector) {}
+
+        ClDeviceVector deviceVector;
+        std::string apiOptions;
+        std::string internalOptions;
+        TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+        CompilerInterface *compilerInterface = nullptr;
+        std::vector<TranslationOutput> compilerOutputs;
+        std::vector<TranslationOutput::ErrorCode> compilerErrors;
+        std::unordered_map<uint32_t, BuildPhase> phaseReached;
+    };
+
+    cl_int prepareBuild(BuildRequest &request, const char *buildOptions, bool enableCaching);
+    static void compileBuildRequest(BuildRequest &request);
+    cl_int publishBuild(BuildRequest &request);
+    void setBuildStatusError(const ClDeviceVector &deviceVector);
+
     MOCKABLE_VIRTUAL cl_int createProgramFromBinary(const void *pBinary, size_t binarySize, ClDevice &clDevice);
 
     cl_int packDeviceBinary(ClDevice &clDevice);
@@ -318,7 +350,7 @@ class Program : public BaseObject<_cl_program> {
 
     struct DeviceBuildInfo {
         StackVec<ClDevice *, 2> associatedSubDevices;
-        cl_build_status buildStatus = CL_BUILD_NONE;
+        std::atomic<cl_build_status> buildStatus{CL_BUILD_NONE};
         cl_program_binary_type programBinaryType = CL_PROGRAM_BINARY_TYPE_NONE;
     };
 
@@ -366,6 +398,7 @@ class Program : public BaseObject<_cl_program> {
 
     bool isBuiltIn = false;
     bool kernelDebugEnabled = false;
+    CompilerCache *kernelDescriptorsCache = nullptr;
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/file_io.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 
@@ -360,6 +361,116 @@ TEST_F(clBuildProgramTests, GivenValidCallbackInputWhenBuildProgramThenCallbackI
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_F(clBuildProgramTests, GivenAsyncProgramBuildEnabledAndValidCallbackWhenBuildProgramThenBuildIsDoneOnWorkerThreadAndCallbackIsInvoked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+
+    cl_program pProgram = nullptr;
+    size_t sourceSize = 0;
+    std::string testFile;
+
+    KernelBinaryHelper kbHelper("CopyBuffer_simd16", false);
+    testFile.append(clFiles);
+    testFile.append("CopyBuffer_simd16.cl");
+
+    auto pSource = loadDataFromFile(
+        testFile.c_str(),
+        sourceSize);
+
+    ASSERT_NE(0u, sourceSize);
+    ASSERT_NE(nullptr, pSource);
+
+    const char *sourceArray[1] = {pSource.get()};
+    pProgram = clCreateProgramWithSource(
+        pContext,
+        1,
+        sourceArray,
+        &sourceSize,
+        &retVal);
+
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, pProgram);
+
+    auto program = castToObject<Program>(pProgram);
+    auto compilerInterface = program->getDevices()[0]->getDevice().getCompilerInterface();
+    ASSERT_NE(nullptr, compilerInterface);
+
+    char userData = 0;
+
+    retVal = clBuildProgram(
+        pProgram,
+        1,
+        &testedClDevice,
+        nullptr,
+        notifyFuncProgram,
+        &userData);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    compilerInterface->getBuildWorkerPool()->waitForIdle();
+    EXPECT_EQ('a', userData);
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, testedClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+    EXPECT_NE(0u, program->getNumKernels());
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(clBuildProgramTests, GivenAsyncProgramBuildEnabledAndProgramCreatedFromBinaryWhenBuildProgramThenBuildIsDoneBeforeReturning) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+
+    cl_program pProgram = nullptr;
+    cl_int binaryStatus = CL_SUCCESS;
+    size_t binarySize = 0;
+    std::string testFile;
+    retrieveBinaryKernelFilename(testFile, "CopyBuffer_simd16_", ".bin");
+
+    auto pBinary = loadDataFromFile(
+        testFile.c_str(),
+        binarySize);
+
+    ASSERT_NE(0u, binarySize);
+    ASSERT_NE(nullptr, pBinary);
+    const unsigned char *binaries[1] = {reinterpret_cast<const unsigned char *>(pBinary.get())};
+    pProgram = clCreateProgramWithBinary(
+        pContext,
+        1,
+        &testedClDevice,
+        &binarySize,
+        binaries,
+        &binaryStatus,
+        &retVal);
+
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, pProgram);
+
+    char userData = 0;
+
+    retVal = clBuildProgram(
+        pProgram,
+        1,
+        &testedClDevice,
+        nullptr,
+        notifyFuncProgram,
+        &userData);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ('a', userData);
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, testedClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
 TEST_F(clBuildProgramTests, givenProgramWhenBuildingForInvalidDevicesInputThenInvalidDeviceErrorIsReturned) {
     cl_program pProgram = nullptr;
     size_t sourceSize = 0;
@@ -1256,6 +1256,36 @@ HWTEST_TEMPLATED_F(BlitEnqueueFlushTests, givenBlockedQueueWhenBlitEnqueuedThenF
     EXPECT_FALSE(commandQueue->isQueueBlocked());
 }
 
+HWTEST_TEMPLATED_F(BlitEnqueueFlushTests, givenEventFromOtherCsrInBatchingModeWhenBlitEnqueuedThenOtherCsrIsFlushed) {
+    auto buffer = createBuffer(1, false);
+    buffer->forceDisallowCPUCopy = true;
+    int hostPtr = 0;
+
+    uint32_t flushCounter = 0;
+    static_cast<MyUltCsr<FamilyType> *>(gpgpuCsr)->flushCounter = &flushCounter;
+    static_cast<MyUltCsr<FamilyType> *>(bcsCsr)->flushCounter = &flushCounter;
+
+    UltCommandStreamReceiver<FamilyType> otherCsr(*device->getExecutionEnvironment(), device->getRootDeviceIndex(), device->getDeviceBitfield());
+    otherCsr.setupContext(gpgpuCsr->getOsContext());
+    otherCsr.initializeTagAllocation();
+    *otherCsr.getTagAddress() = 0u;
+    EngineControl otherEngine(&otherCsr, &gpgpuCsr->getOsContext());
+
+    MockCommandQueueHw<FamilyType> otherQueue(bcsMockContext.get(), device.get(), nullptr);
+    otherQueue.gpgpuEngine = &otherEngine;
+
+    Event event(&otherQueue, CL_COMMAND_NDRANGE_KERNEL, 0, 1);
+    cl_event waitlist[] = {&event};
+
+    otherCsr.overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+    commandQueue->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 1, waitlist, nullptr);
+    EXPECT_FALSE(otherCsr.flushBatchedSubmissionsCalled);
+
+    otherCsr.overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+    commandQueue->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 1, waitlist, nullptr);
+    EXPECT_TRUE(otherCsr.flushBatchedSubmissionsCalled);
+}
+
 HWTEST_TEMPLATED_F(BlitEnqueueFlushTests, givenDebugFlagSetWhenCheckingBcsCacheFlushRequirementThenReturnCorrectValue) {
     auto mockCommandQueue = static_cast<MockCommandQueueHw<FamilyType> *>(commandQueue.get());
 
@@ -5,11 +5,18 @@
  *
  */
 
+#include "opencl/source/event/event.h"
 #include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
 #include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_csr.h"
+#include "opencl/test/unit_test/mocks/mock_ostime.h"
 #include "opencl/test/unit_test/mocks/mock_submissions_aggregator.h"
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+
 typedef HelloWorldFixture<HelloWorldFixtureFactory> EnqueueKernelFixture;
 typedef Test<EnqueueKernelFixture> EnqueueKernelTest;
 
@@ -67,3 +74,137 @@ HWTEST_F(EnqueueKernelTest, givenCsrInBatchingModeWhenFinishIsCalledThenBatchesS
 
     EXPECT_EQ(mockedSubmissionsAggregator->peekInspectionId() - 1, (uint32_t)mockCsr->flushCalledCount);
 }
+
+HWTEST_F(EnqueueKernelTest, givenMultipleThreadsEnqueueingWithEventsWhenEnqueuesAreDoneThenEachEventGetsUniqueTaskCount) {
+    std::atomic<bool> startEnqueueProcess(false);
+
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 0, 0};
+
+    constexpr auto enqueueCount = 10;
+    constexpr auto threadCount = 4;
+    std::vector<cl_event> events(enqueueCount * threadCount, nullptr);
+
+    auto initialTaskCount = pCmdQ->getGpgpuCommandStreamReceiver().peekTaskCount();
+
+    auto function = [&](int threadId) {
+        while (!startEnqueueProcess)
+            ;
+        for (int enqueue = 0; enqueue < enqueueCount; enqueue++) {
+            pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &events[threadId * enqueueCount + enqueue]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto thread = 0; thread < threadCount; thread++) {
+        threads.push_back(std::thread(function, thread));
+    }
+
+    startEnqueueProcess = true;
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    pCmdQ->finish();
+
+    std::vector<uint32_t> taskCounts;
+    for (auto &event : events) {
+        ASSERT_NE(nullptr, event);
+        taskCounts.push_back(castToObject<Event>(event)->peekTaskCount());
+        clReleaseEvent(event);
+    }
+    std::sort(taskCounts.begin(), taskCounts.end());
+    EXPECT_EQ(taskCounts.end(), std::adjacent_find(taskCounts.begin(), taskCounts.end()));
+    EXPECT_LE(initialTaskCount + enqueueCount * threadCount, pCmdQ->getGpgpuCommandStreamReceiver().peekTaskCount());
+}
+
+template <typename GfxFamily>
+class CsrOwnershipCheckingOsTime : public MockOSTime {
+  public:
+    CsrOwnershipCheckingOsTime(UltCommandStreamReceiver<GfxFamily> &csr) : csr(csr) {}
+
+    bool getCpuTime(uint64_t *timeStamp) override {
+        //ownership is checked from other thread, csr mutex is recursive
+        auto csrOwned = std::async(std::launch::async, [this]() {
+                            std::unique_lock<CommandStreamReceiver::MutexType> lock(csr.ownershipMutex, std::try_to_lock);
+                            return !lock.owns_lock();
+                        }).get();
+        csrOwnedOnCpuTimeQuery.push_back(csrOwned);
+        return MockOSTime::getCpuTime(timeStamp);
+    }
+
+    UltCommandStreamReceiver<GfxFamily> &csr;
+    std::vector<bool> csrOwnedOnCpuTimeQuery;
+};
+
+HWTEST_F(EnqueueKernelTest, givenProfilingEnabledWhenEnqueueingKernelThenQueueTimestampIsTakenBeforeCsrOwnershipIsObtained) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto osTime = new CsrOwnershipCheckingOsTime<FamilyType>(csr);
+    pClDevice->setOSTime(osTime);
+
+    MockCommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, nullptr);
+    cmdQ.setProfilingEnabled();
+
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 0, 0};
+    cl_event event = nullptr;
+
+    auto retVal = cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_FALSE(osTime->csrOwnedOnCpuTimeQuery.empty());
+    EXPECT_FALSE(osTime->csrOwnedOnCpuTimeQuery[0]);
+
+    cmdQ.finish();
+    clReleaseEvent(event);
+}
+
+class QueueTimestampSignalingOsTime : public MockOSTime {
+  public:
+    bool getCpuTime(uint64_t *timeStamp) override {
+        cpuTimeQueried = true;
+        return MockOSTime::getCpuTime(timeStamp);
+    }
+
+    std::atomic<bool> cpuTimeQueried{false};
+};
+
+HWTEST_F(EnqueueKernelTest, givenCsrOwnedByOtherThreadWhenEnqueueingKernelWithProfilingThenEventIsSetUpWhileEnqueueWaitsForOwnership) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto osTime = new QueueTimestampSignalingOsTime();
+    pClDevice->setOSTime(osTime);
+
+    MockCommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, nullptr);
+    cmdQ.setProfilingEnabled();
+
+    MockKernelWithInternals mockKernel(*pClDevice);
+    size_t gws[3] = {1, 0, 0};
+    cl_event event = nullptr;
+    std::atomic<bool> enqueueDone(false);
+
+    std::unique_lock<CommandStreamReceiver::MutexType> csrOwnership(csr.ownershipMutex);
+    auto initialTaskCount = csr.peekTaskCount();
+
+    std::thread enqueueThread([&]() {
+        cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+        enqueueDone = true;
+    });
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!osTime->cpuTimeQueried && (std::chrono::steady_clock::now() < timeout)) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(osTime->cpuTimeQueried);
+    EXPECT_FALSE(enqueueDone);
+    EXPECT_EQ(initialTaskCount, csr.peekTaskCount());
+
+    csrOwnership.unlock();
+    enqueueThread.join();
+
+    EXPECT_TRUE(enqueueDone);
+    EXPECT_EQ(initialTaskCount + 1, csr.peekTaskCount());
+
+    cmdQ.finish();
+    clReleaseEvent(event);
+}
@@ -1915,3 +1915,96 @@ TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMemFillThenAllocIsDecommi
 
     context->memoryManager = memoryManager;
 }
+
+TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMigrateMemToDeviceThenAllocIsMovedToGpuDomain) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto pageFaultManager = static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager());
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    pageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    const void *svmPtrs[] = {ptrSVM};
+
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
+    EXPECT_EQ(pageFaultManager->memoryData.at(ptrSVM).domain, PageFaultManager::AllocationDomain::Gpu);
+
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPageFaultManagerWhenEnqueueMigrateMemToHostThenAllocIsMovedToCpuDomain) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto pageFaultManager = static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager());
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    pageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    pageFaultManager->memoryData.at(ptrSVM).domain = PageFaultManager::AllocationDomain::Gpu;
+    const void *svmPtrs[] = {ptrOffset(ptrSVM, 128)};
+
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrSVM);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->memoryData.at(ptrSVM).domain, PageFaultManager::AllocationDomain::Cpu);
+
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPageFaultManagerAndNotCompletedUserEventWhenEnqueueMigrateMemThenAllocIsNotMoved) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto pageFaultManager = static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager());
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    pageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    const void *svmPtrs[] = {ptrSVM};
+    UserEvent userEvent;
+    cl_event waitList[] = {&userEvent};
+
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, 0, 1, waitList, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 0);
+    EXPECT_EQ(pageFaultManager->memoryData.at(ptrSVM).domain, PageFaultManager::AllocationDomain::Cpu);
+
+    userEvent.setStatus(CL_COMPLETE);
+    context->memoryManager = memoryManager;
+}
+
+TEST_F(EnqueueSvmTest, givenPageFaultManagerAndAllocUsedByPendingGpuWorkWhenEnqueueMigrateMemToHostThenAllocIsNotMoved) {
+    auto mockMemoryManager = std::make_unique<MockMemoryManager>();
+    mockMemoryManager->pageFaultManager.reset(new MockPageFaultManager());
+    auto pageFaultManager = static_cast<MockPageFaultManager *>(mockMemoryManager->getPageFaultManager());
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    mockMemoryManager->registeredEngines.push_back(EngineControl{&csr, &csr.getOsContext()});
+    auto memoryManager = context->getMemoryManager();
+    context->memoryManager = mockMemoryManager.get();
+    pageFaultManager->insertAllocation(ptrSVM, 256, context->getSVMAllocsManager(), context->getSpecialQueue(0u), {});
+    pageFaultManager->memoryData.at(ptrSVM).domain = PageFaultManager::AllocationDomain::Gpu;
+    auto gpuAllocation = context->getSVMAllocsManager()->getSVMAlloc(ptrSVM)->gpuAllocations.getGraphicsAllocation(pDevice->getRootDeviceIndex());
+    auto contextId = csr.getOsContext().getContextId();
+    gpuAllocation->updateTaskCount(*csr.getTagAddress() + 1, contextId);
+    const void *svmPtrs[] = {ptrSVM};
+
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+    EXPECT_EQ(pageFaultManager->memoryData.at(ptrSVM).domain, PageFaultManager::AllocationDomain::Gpu);
+
+    gpuAllocation->releaseUsageInOsContext(contextId);
+    retVal = pCmdQ->enqueueSVMMigrateMem(1, svmPtrs, nullptr, CL_MIGRATE_MEM_OBJECT_HOST, 0, nullptr, nullptr);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->memoryData.at(ptrSVM).domain, PageFaultManager::AllocationDomain::Cpu);
+
+    mockMemoryManager->registeredEngines.clear();
+    context->memoryManager = memoryManager;
+}
@@ -11,6 +11,7 @@
 #include "opencl/source/command_queue/gpgpu_walker.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "opencl/test/unit_test/mocks/ult_cl_device_factory.h"
 #include "test.h"
 
 using namespace NEO;
@@ -812,3 +813,129 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenDispatchWithoutEnqueuedLwsWhenWorkgroupSizeIsGeneratedThenItIsCachedInKernel) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(1);
+    dispatchInfo.setGWS({1024, 1, 1});
+
+    auto lws = generateWorkgroupSize(dispatchInfo);
+    ASSERT_EQ(1u, kernel.mockKernel->localWorkSizeCache.size());
+    EXPECT_EQ(lws, kernel.mockKernel->localWorkSizeCache.begin()->second);
+
+    Vec3<size_t> cachedLws{0, 0, 0};
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(device, {1024, 1, 1}, 1, cachedLws));
+    EXPECT_EQ(lws, cachedLws);
+
+    EXPECT_EQ(lws, generateWorkgroupSize(dispatchInfo));
+    EXPECT_EQ(1u, kernel.mockKernel->localWorkSizeCache.size());
+}
+
+TEST(localWorkSizeTest, givenCachedLwsWhenSlmSizeChangesThenLwsIsNotTakenFromCache) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+
+    Vec3<size_t> lws{0, 0, 0};
+    kernel.mockKernel->cacheLocalWorkSize(device, {256, 1, 1}, 1, {32, 1, 1});
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 1, 1}, 1, lws));
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {512, 1, 1}, 1, lws));
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 1, 1}, 2, lws));
+
+    kernel.mockKernel->slmTotalSize += 1024u;
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 1, 1}, 1, lws));
+}
+
+TEST(localWorkSizeTest, givenLwsCachedForOneDeviceWhenLookingUpForOtherDeviceThenLwsIsNotTakenFromCache) {
+    UltClDeviceFactory deviceFactory{1, 2};
+    auto &rootDevice = *deviceFactory.rootDevices[0];
+    MockKernelWithInternals kernel(rootDevice);
+
+    Vec3<size_t> lws{0, 0, 0};
+    kernel.mockKernel->cacheLocalWorkSize(*deviceFactory.subDevices[0], {256, 1, 1}, 1, {32, 1, 1});
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(*deviceFactory.subDevices[0], {256, 1, 1}, 1, lws));
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(*deviceFactory.subDevices[1], {256, 1, 1}, 1, lws));
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(rootDevice, {256, 1, 1}, 1, lws));
+}
+
+TEST(localWorkSizeTest, givenEnqueuedLwsWhenWorkgroupSizeIsGeneratedThenNothingIsCached) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(1);
+    dispatchInfo.setGWS({1024, 1, 1});
+    dispatchInfo.setEnqueuedWorkgroupSize({16, 1, 1});
+
+    EXPECT_EQ(Vec3<size_t>(16, 1, 1), generateWorkgroupSize(dispatchInfo));
+    EXPECT_TRUE(kernel.mockKernel->localWorkSizeCache.empty());
+}
+
+TEST(localWorkSizeTest, givenLwsCacheDisabledWhenWorkgroupSizeIsGeneratedThenNothingIsCached) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(0);
+
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(1);
+    dispatchInfo.setGWS({1024, 1, 1});
+
+    generateWorkgroupSize(dispatchInfo);
+    EXPECT_TRUE(kernel.mockKernel->localWorkSizeCache.empty());
+}
+
+TEST(localWorkSizeTest, givenFullLwsCacheWhenNewEntryIsAddedThenOldestEntryIsEvicted) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+
+    for (size_t i = 0; i < Kernel::maxLocalWorkSizeCacheEntries; i++) {
+        kernel.mockKernel->cacheLocalWorkSize(device, {i + 1, 1, 1}, 1, {1, 1, 1});
+    }
+    EXPECT_EQ(Kernel::maxLocalWorkSizeCacheEntries, kernel.mockKernel->localWorkSizeCache.size());
+
+    kernel.mockKernel->cacheLocalWorkSize(device, {Kernel::maxLocalWorkSizeCacheEntries + 1, 1, 1}, 1, {1, 1, 1});
+    EXPECT_EQ(Kernel::maxLocalWorkSizeCacheEntries, kernel.mockKernel->localWorkSizeCache.size());
+
+    Vec3<size_t> lws{0, 0, 0};
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {1, 1, 1}, 1, lws));
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(device, {2, 1, 1}, 1, lws));
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(device, {Kernel::maxLocalWorkSizeCacheEntries + 1, 1, 1}, 1, lws));
+}
+
+TEST(localWorkSizeTest, givenBuiltinKernelWhenWorkgroupSizeIsGeneratedThenNothingIsCached) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    kernel.mockKernel->isBuiltIn = true;
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setDim(1);
+    dispatchInfo.setGWS({1024, 1, 1});
+
+    generateWorkgroupSize(dispatchInfo);
+    EXPECT_TRUE(kernel.mockKernel->localWorkSizeCache.empty());
+}
+
+TEST(localWorkSizeTest, givenCachedLwsWhenLwsAlgorithmSelectionChangesThenLwsIsNotTakenFromCache) {
+    DebugManagerStateRestore restorer;
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+
+    Vec3<size_t> lws{0, 0, 0};
+    kernel.mockKernel->cacheLocalWorkSize(device, {256, 16, 1}, 2, {32, 1, 1});
+    EXPECT_TRUE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 16, 1}, 2, lws));
+
+    DebugManager.flags.EnableComputeWorkSizeND.set(!DebugManager.flags.EnableComputeWorkSizeND.get());
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 16, 1}, 2, lws));
+
+    DebugManager.flags.EnableComputeWorkSizeND.set(!DebugManager.flags.EnableComputeWorkSizeND.get());
+    DebugManager.flags.EnableComputeWorkSizeSquared.set(!DebugManager.flags.EnableComputeWorkSizeSquared.get());
+    EXPECT_FALSE(kernel.mockKernel->getCachedLocalWorkSize(device, {256, 16, 1}, 2, lws));
+}
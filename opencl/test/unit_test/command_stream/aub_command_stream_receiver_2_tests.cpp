@@ -247,6 +247,38 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenForcedB
     EXPECT_EQ(0x1, static_cast<char *>(flatBatchBuffer->getUnderlyingBuffer())[0x40 + 0x40]);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenForcedBatchBufferFlatteningInBatchedDispatchWithCounterModeThenNewCombinedBatchBufferIsCreated) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.FlattenBatchBufferForAUBDump.set(true);
+    DebugManager.flags.CsrDispatchMode.set(static_cast<uint32_t>(DispatchMode::BatchedDispatchWithCounter));
+
+    auto aubExecutionEnvironment = getEnvironment<AUBCommandStreamReceiverHw<FamilyType>>(false, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<AUBCommandStreamReceiverHw<FamilyType>>();
+    auto memoryManager = aubExecutionEnvironment->executionEnvironment->memoryManager.get();
+    LinearStream cs(aubExecutionEnvironment->commandBuffer);
+
+    CommandChunk chunk;
+    std::unique_ptr<char> commands(new char[0x100u]);
+    commands.get()[0] = 0x1;
+    chunk.baseAddressCpu = chunk.baseAddressGpu = reinterpret_cast<uint64_t>(commands.get());
+    chunk.startOffset = 0u;
+    chunk.endOffset = 0x50u;
+    aubCsr->getFlatBatchBufferHelper().registerCommandChunk(chunk);
+
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 128u, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    size_t sizeBatchBuffer = 0u;
+
+    std::unique_ptr<GraphicsAllocation, std::function<void(GraphicsAllocation *)>> flatBatchBuffer(
+        aubCsr->getFlatBatchBufferHelper().flattenBatchBuffer(aubCsr->getRootDeviceIndex(), batchBuffer, sizeBatchBuffer, DispatchMode::BatchedDispatchWithCounter, pDevice->getDeviceBitfield()),
+        [&](GraphicsAllocation *ptr) { memoryManager->freeGraphicsMemory(ptr); });
+
+    EXPECT_NE(nullptr, flatBatchBuffer.get());
+    EXPECT_NE(0u, sizeBatchBuffer);
+    EXPECT_EQ(0u, aubCsr->getFlatBatchBufferHelper().getCommandChunkList().size());
+    EXPECT_EQ(0x1, static_cast<char *>(flatBatchBuffer->getUnderlyingBuffer())[0]);
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenDefaultDebugConfigThenExpectFlattenBatchBufferIsNotCalled) {
     auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
     auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
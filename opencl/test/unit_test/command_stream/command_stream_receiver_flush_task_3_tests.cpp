@@ -609,6 +609,98 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenFlushTas
     EXPECT_EQ(2u, csr.peekLatestFlushedTaskCount());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingWithCounterModeWhenSubmissionBudgetIsExhaustedThenBatchedCommandBuffersAreFlushed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(2);
+    DebugManager.flags.BatchedDispatchMaxCommandBufferSize.set(0);
+    DebugManager.flags.BatchedDispatchMaxLatency.set(0);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.implicitFlush = false;
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1u, mockCsr->peekLatestSentTaskCount());
+    EXPECT_EQ(0u, mockCsr->peekLatestFlushedTaskCount());
+    EXPECT_FALSE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(2u, mockCsr->peekLatestSentTaskCount());
+    EXPECT_EQ(2u, mockCsr->peekLatestFlushedTaskCount());
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, mockCsr->flushCalledCount);
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(3u, mockCsr->peekLatestSentTaskCount());
+    EXPECT_EQ(2u, mockCsr->peekLatestFlushedTaskCount());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenSubmissionBudgetIsExhaustedThenBatchedCommandBuffersAreNotFlushed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxCommandBuffers.set(1);
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.implicitFlush = false;
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->useNewResourceImplicitFlush = false;
+    mockCsr->useGpuIdleImplicitFlush = false;
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(2u, mockCsr->peekLatestSentTaskCount());
+    EXPECT_EQ(0u, mockCsr->peekLatestFlushedTaskCount());
+    EXPECT_EQ(0u, mockCsr->flushCalledCount);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenEventFromOtherCsrIsPassedAsDependencyThenOtherCsrIsFlushed) {
+    MockContext context(pClDevice);
+    auto &secondEngine = pDevice->getEngine(pDevice->getHardwareInfo().capabilityTable.defaultEngineType, EngineUsage::LowPriority);
+    auto secondCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(secondEngine.commandStreamReceiver);
+
+    MockCommandQueueHw<FamilyType> cmdQ0(&context, pClDevice, nullptr);
+    MockCommandQueueHw<FamilyType> cmdQ1(&context, pClDevice, nullptr);
+    cmdQ1.gpgpuEngine = &secondEngine;
+    ASSERT_NE(&cmdQ0.getGpgpuCommandStreamReceiver(), &cmdQ1.getGpgpuCommandStreamReceiver());
+
+    *secondCsr->getTagAddress() = 0u;
+    secondCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+    secondCsr->flushBatchedSubmissionsCalled = false;
+
+    Event event(&cmdQ1, CL_COMMAND_NDRANGE_KERNEL, 0, 1);
+    cl_event waitlist[] = {&event};
+
+    cmdQ0.flushOutOfCsrDependencies(1, waitlist, cmdQ0.getGpgpuCommandStreamReceiver());
+    EXPECT_TRUE(secondCsr->flushBatchedSubmissionsCalled);
+
+    secondCsr->flushBatchedSubmissionsCalled = false;
+    secondCsr->overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+    cmdQ0.flushOutOfCsrDependencies(1, waitlist, cmdQ0.getGpgpuCommandStreamReceiver());
+    EXPECT_FALSE(secondCsr->flushBatchedSubmissionsCalled);
+
+    secondCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    cmdQ1.flushOutOfCsrDependencies(1, waitlist, cmdQ1.getGpgpuCommandStreamReceiver());
+    EXPECT_FALSE(secondCsr->flushBatchedSubmissionsCalled);
+
+    cmdQ1.flushOutOfCsrDependencies(1, waitlist, cmdQ0.getGpgpuCommandStreamReceiver());
+    EXPECT_TRUE(secondCsr->flushBatchedSubmissionsCalled);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenWaitForTaskCountIsCalledWithTaskCountThatWasNotYetFlushedThenBatchedCommandBuffersAreSubmitted) {
     CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
     auto &commandStream = commandQueue.getCS(4096u);
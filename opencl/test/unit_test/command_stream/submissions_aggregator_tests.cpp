@@ -21,6 +21,8 @@
 using namespace NEO;
 
 struct MockSubmissionAggregator : public SubmissionAggregator {
+    using SubmissionAggregator::oldestRecordTimestamp;
+
     CommandBufferList &peekCommandBuffersList() {
         return this->cmdBuffers;
     }
@@ -574,6 +576,81 @@ TEST(SubmissionsAggregator, givenCommandBuffersRequiringDifferentSliceCountSetti
     EXPECT_EQ(1u, cmdBuffer->inspectionId);
 }
 
+TEST(SubmissionsAggregator, givenNoSubmissionBudgetWhenCommandBuffersAreRecordedThenBudgetIsNotExhausted) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    for (auto i = 0u; i < 128u; i++) {
+        CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+        cmdBuffer->batchBuffer.usedSize = 4096u;
+        submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    }
+    EXPECT_EQ(128u, submissionsAggregator.peekPendingCommandBuffers());
+    EXPECT_EQ(128u * 4096u, submissionsAggregator.peekPendingCommandBufferSize());
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+}
+
+TEST(SubmissionsAggregator, givenCommandBufferCountBudgetWhenLimitIsReachedThenBudgetIsExhausted) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setSubmissionBudget(2u, 0u, std::chrono::microseconds(0));
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_TRUE(submissionsAggregator.isSubmissionBudgetExhausted());
+}
+
+TEST(SubmissionsAggregator, givenCommandBufferSizeBudgetWhenLimitIsReachedThenBudgetIsExhausted) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setSubmissionBudget(0u, 1024u, std::chrono::microseconds(0));
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    cmdBuffer->batchBuffer.startOffset = 256u;
+    cmdBuffer->batchBuffer.usedSize = 768u;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    EXPECT_EQ(512u, submissionsAggregator.peekPendingCommandBufferSize());
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+    cmdBuffer2->batchBuffer.startOffset = 768u;
+    cmdBuffer2->batchBuffer.usedSize = 1280u;
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    EXPECT_EQ(1024u, submissionsAggregator.peekPendingCommandBufferSize());
+    EXPECT_TRUE(submissionsAggregator.isSubmissionBudgetExhausted());
+}
+
+TEST(SubmissionsAggregator, givenLatencyBudgetWhenOldestCommandBufferExceedsItThenBudgetIsExhausted) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setSubmissionBudget(0u, 0u, std::chrono::microseconds(1000000));
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    submissionsAggregator.oldestRecordTimestamp -= std::chrono::seconds(2);
+    EXPECT_TRUE(submissionsAggregator.isSubmissionBudgetExhausted());
+}
+
+TEST(SubmissionsAggregator, givenExhaustedBudgetWhenCommandBuffersAreRemovedThenBudgetIsResetOnNextRecord) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setSubmissionBudget(1u, 0u, std::chrono::microseconds(0));
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_TRUE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    submissionsAggregator.peekCommandBuffersList().removeFrontOne();
+    EXPECT_FALSE(submissionsAggregator.isSubmissionBudgetExhausted());
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_EQ(1u, submissionsAggregator.peekPendingCommandBuffers());
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
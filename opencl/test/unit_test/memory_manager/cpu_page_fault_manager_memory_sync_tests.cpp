@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 #include "shared/test/unit_test/page_fault_manager/cpu_page_fault_manager_tests_fixture.h"
@@ -17,6 +18,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <map>
+#include <vector>
+
 using namespace NEO;
 
 struct CommandQueueMock : public MockCommandQueue {
@@ -105,3 +110,101 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+TEST_F(PageFaultManagerTest, givenPrefetchedAllocNotAccessedByCpuWhenGpuWritesItThenNextCpuFaultReadsGpuData) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationPredictionThreshold.set(1);
+
+    // copies data between svm memory and separate gpu storage the same way map and unmap of shared allocations do
+    struct DataCopyCommandQueue : public MockCommandQueue {
+        cl_int enqueueSVMMap(cl_bool blockingMap, cl_map_flags mapFlags,
+                             void *svmPtr, size_t size,
+                             cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                             cl_event *event, bool externalAppCall) override {
+            if (svmAllocsManager->getSvmMapOperation(svmPtr) == nullptr) {
+                memcpy(svmPtr, gpuStorage[svmPtr].data(), size);
+                svmAllocsManager->insertSvmMapOperation(svmPtr, size, svmPtr, 0, mapFlags == CL_MAP_READ);
+            }
+            return CL_SUCCESS;
+        }
+        cl_int enqueueSVMUnmap(void *svmPtr,
+                               cl_uint numEventsInWaitList, const cl_event *eventWaitList,
+                               cl_event *event, bool externalAppCall) override {
+            auto svmOperation = svmAllocsManager->getSvmMapOperation(svmPtr);
+            if (svmOperation) {
+                memcpy(gpuStorage[svmPtr].data(), svmPtr, svmOperation->regionSize);
+                svmAllocsManager->removeSvmMapOperation(svmPtr);
+            }
+            return CL_SUCCESS;
+        }
+        cl_int finish() override {
+            return CL_SUCCESS;
+        }
+
+        SVMAllocsManager *svmAllocsManager = nullptr;
+        std::map<void *, std::vector<uint8_t>> gpuStorage;
+    };
+
+    struct DataCopyPageFaultManager : public MockPageFaultManager {
+        void transferToCpu(void *ptr, size_t size, void *cmdQ) override {
+            PageFaultManager::transferToCpu(ptr, size, cmdQ);
+        }
+        void transferToGpu(void *ptr, void *cmdQ) override {
+            PageFaultManager::transferToGpu(ptr, cmdQ);
+        }
+        void discardCpuCopy(void *ptr, void *cmdQ) override {
+            PageFaultManager::discardCpuCopy(ptr, cmdQ);
+        }
+    };
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    std::set<uint32_t> rootDeviceIndices{rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    constexpr size_t size = 256;
+    void *faultingAlloc = svmAllocsManager->createSVMAlloc(size, {}, rootDeviceIndices, deviceBitfields);
+    void *predictedAlloc = svmAllocsManager->createSVMAlloc(size, {}, rootDeviceIndices, deviceBitfields);
+
+    auto cmdQ = std::make_unique<DataCopyCommandQueue>();
+    cmdQ->device = device.get();
+    cmdQ->svmAllocsManager = svmAllocsManager.get();
+    cmdQ->gpuStorage[faultingAlloc].resize(size);
+    cmdQ->gpuStorage[predictedAlloc].resize(size);
+
+    auto faultManager = std::make_unique<DataCopyPageFaultManager>();
+    faultManager->insertAllocation(faultingAlloc, size, svmAllocsManager.get(), cmdQ.get(), {});
+    faultManager->insertAllocation(predictedAlloc, size, svmAllocsManager.get(), cmdQ.get(), {});
+
+    memset(predictedAlloc, 1, size);
+    faultManager->moveAllocationToGpuDomain(faultingAlloc);
+    faultManager->moveAllocationToGpuDomain(predictedAlloc);
+    faultManager->verifyPageFault(predictedAlloc);
+    EXPECT_EQ(1u, faultManager->predictedAllocations.count(predictedAlloc));
+
+    faultManager->moveAllocationToGpuDomain(faultingAlloc);
+    faultManager->moveAllocationToGpuDomain(predictedAlloc);
+    memset(cmdQ->gpuStorage[predictedAlloc].data(), 2, size);
+    faultManager->verifyPageFault(faultingAlloc);
+    ASSERT_TRUE(faultManager->memoryData.at(predictedAlloc).prefetchedToCpu);
+    EXPECT_EQ(2u, static_cast<uint8_t *>(predictedAlloc)[0]);
+
+    faultManager->moveAllocationToGpuDomain(faultingAlloc);
+    faultManager->moveAllocationToGpuDomain(predictedAlloc);
+    EXPECT_FALSE(faultManager->memoryData.at(predictedAlloc).prefetchedToCpu);
+    EXPECT_EQ(nullptr, svmAllocsManager->getSvmMapOperation(predictedAlloc));
+
+    memset(cmdQ->gpuStorage[predictedAlloc].data(), 3, size);
+    faultManager->verifyPageFault(predictedAlloc);
+    EXPECT_EQ(3u, static_cast<uint8_t *>(predictedAlloc)[0]);
+    EXPECT_EQ(3u, static_cast<uint8_t *>(predictedAlloc)[size - 1]);
+
+    faultManager->removeAllocation(faultingAlloc);
+    faultManager->removeAllocation(predictedAlloc);
+    svmAllocsManager->freeSVMAlloc(faultingAlloc);
+    svmAllocsManager->freeSVMAlloc(predictedAlloc);
+    cmdQ->device = nullptr;
+}
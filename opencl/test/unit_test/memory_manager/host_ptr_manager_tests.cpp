@@ -833,6 +833,99 @@ TEST_F(HostPtrManagerTest, GivenHostPtrManagerFilledWithFragmentsWhenAskedForOve
     EXPECT_NE(nullptr, fragment3);
 }
 
+TEST_F(HostPtrManagerTest, givenFragmentsInDifferentAddressRegionsWhenStoringThenEachFragmentUsesShardOfItsRegion) {
+    MockHostPtrManager hostPtrManager;
+
+    FragmentStorage fragment;
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    for (uint32_t i = 0; i < HostPtrManager::shardsCount; i++) {
+        fragment.fragmentCpuPointer = reinterpret_cast<void *>((i + 1) * HostPtrManager::shardRegionSize);
+        hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+    }
+
+    for (auto &shard : hostPtrManager.shards) {
+        EXPECT_EQ(1u, shard.partialAllocations.size());
+    }
+    EXPECT_EQ(HostPtrManager::shardsCount, hostPtrManager.getFragmentCount());
+}
+
+TEST_F(HostPtrManagerTest, givenFragmentSpanningAddressRegionsWhenStoringAndReleasingThenItIsSharedByShardsOfAllItsRegions) {
+    MockHostPtrManager hostPtrManager;
+    auto ptr = reinterpret_cast<void *>(HostPtrManager::shardRegionSize - MemoryConstants::pageSize);
+    auto ptrInNextRegion = reinterpret_cast<void *>(HostPtrManager::shardRegionSize);
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = ptr;
+    fragment.fragmentSize = 2 * MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+
+    EXPECT_EQ(1u, hostPtrManager.getFragmentCount());
+    EXPECT_EQ(1u, hostPtrManager.shards[hostPtrManager.getShardIndex(ptr)].partialAllocations.size());
+    EXPECT_EQ(1u, hostPtrManager.shards[hostPtrManager.getShardIndex(ptrInNextRegion)].partialAllocations.size());
+
+    auto storedFragment = hostPtrManager.getFragment({ptr, rootDeviceIndex});
+    ASSERT_NE(nullptr, storedFragment);
+    EXPECT_EQ(storedFragment, hostPtrManager.getFragment({ptrInNextRegion, rootDeviceIndex}));
+    EXPECT_EQ(2, storedFragment->refCount);
+
+    EXPECT_FALSE(hostPtrManager.releaseHostPtr(rootDeviceIndex, ptr));
+    EXPECT_EQ(1, storedFragment->refCount);
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(rootDeviceIndex, ptr));
+    for (auto &shard : hostPtrManager.shards) {
+        EXPECT_TRUE(shard.partialAllocations.empty());
+    }
+}
+
+TEST_F(HostPtrManagerTest, givenFragmentStartingInNextAddressRegionWhenCheckingOverlapsForRangeCrossingRegionsThenBiggerOverlapIsReturned) {
+    MockHostPtrManager hostPtrManager;
+    auto ptr = reinterpret_cast<void *>(HostPtrManager::shardRegionSize);
+
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = ptr;
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+
+    OverlapStatus overlappingStatus;
+    auto inputPtr = reinterpret_cast<void *>(HostPtrManager::shardRegionSize - MemoryConstants::pageSize);
+    auto storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, inputPtr, MemoryConstants::pageSize, overlappingStatus);
+    EXPECT_EQ(nullptr, storedFragment);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlappingStatus);
+
+    storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, inputPtr, 2 * MemoryConstants::pageSize, overlappingStatus);
+    EXPECT_EQ(nullptr, storedFragment);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlappingStatus);
+}
+
+TEST_F(HostPtrManagerTest, givenStoredFragmentWithPrecedingNeighbourWhenCheckingOverlapsForSameStartAddressThenStoredFragmentIsReturned) {
+    MockHostPtrManager hostPtrManager;
+    auto ptr1 = reinterpret_cast<void *>(0x1000);
+    auto ptr2 = ptrOffset(ptr1, MemoryConstants::pageSize);
+
+    FragmentStorage fragment1;
+    fragment1.fragmentCpuPointer = ptr1;
+    fragment1.fragmentSize = MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment1);
+
+    FragmentStorage fragment2;
+    fragment2.fragmentCpuPointer = ptr2;
+    fragment2.fragmentSize = 2 * MemoryConstants::pageSize;
+    hostPtrManager.storeFragment(rootDeviceIndex, fragment2);
+
+    OverlapStatus overlappingStatus;
+    auto fragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, ptr2, 2 * MemoryConstants::pageSize, overlappingStatus);
+    EXPECT_EQ(ptr2, fragment->fragmentCpuPointer);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT, overlappingStatus);
+
+    fragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, ptr2, MemoryConstants::pageSize, overlappingStatus);
+    EXPECT_EQ(ptr2, fragment->fragmentCpuPointer);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT, overlappingStatus);
+
+    fragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, ptr2, 3 * MemoryConstants::pageSize, overlappingStatus);
+    EXPECT_EQ(nullptr, fragment);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlappingStatus);
+}
+
 using HostPtrAllocationTest = Test<MemoryManagerWithCsrFixture>;
 
 TEST_F(HostPtrAllocationTest, givenTwoAllocationsThatSharesOneFragmentWhenOneIsDestroyedThenFragmentRemains) {
@@ -222,6 +222,72 @@ TEST_F(InternalAllocationStorageTest, givenAllocationWhenItIsPutOnReusableListWh
     EXPECT_EQ(nullptr, internalAllocation);
 }
 
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingAllocationThenSmallestSufficientOneIsReturned) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 3 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation3 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    *csr->getTagAddress() = 0;
+
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation3), REUSABLE_ALLOCATION);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize() + allocation2->getUnderlyingBufferSize() + allocation3->getUnderlyingBufferSize(), csr->getAllocationsForReuse().getTotalSize());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize + 1, GraphicsAllocation::AllocationType::BUFFER).release();
+    EXPECT_EQ(allocation3, reusedAllocation);
+    EXPECT_EQ(allocation->getUnderlyingBufferSize() + allocation2->getUnderlyingBufferSize(), csr->getAllocationsForReuse().getTotalSize());
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), allocation, allocation2));
+
+    memoryManager->freeGraphicsMemory(reusedAllocation);
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsSizeLimitWhenLimitIsExceededThenOldestCompletedAllocationsAreReleased) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation3 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation4 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocationSize = allocation->getUnderlyingBufferSize();
+
+    DebugManagerStateRestore stateRestorer;
+    DebugManager.flags.ReusableAllocationsCacheSizeLimit.set(2 * allocationSize);
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation3), REUSABLE_ALLOCATION, 1u);
+    EXPECT_EQ(2 * allocationSize, csr->getAllocationsForReuse().getTotalSize());
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), allocation, allocation3));
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation4), REUSABLE_ALLOCATION, 2u);
+    EXPECT_EQ(2 * allocationSize, csr->getAllocationsForReuse().getTotalSize());
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), allocation, allocation4));
+
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(0u, csr->getAllocationsForReuse().getTotalSize());
+}
+
+TEST_F(InternalAllocationStorageTest, givenPartiallyCompletedReusableListWhenCleaningThenRemainingAllocationsStayIndexed) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+    auto allocation3 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 3 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation3), REUSABLE_ALLOCATION, 2u);
+
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(allocation2->getUnderlyingBufferSize(), csr->getAllocationsForReuse().getTotalSize());
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), allocation2));
+
+    *csr->getTagAddress() = 5u;
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER).release();
+    EXPECT_EQ(allocation2, reusedAllocation);
+    EXPECT_EQ(0u, csr->getAllocationsForReuse().getTotalSize());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation);
+}
+
 class WaitAtDeletionAllocation : public MockGraphicsAllocation {
   public:
     WaitAtDeletionAllocation(void *buffer, size_t sizeIn)
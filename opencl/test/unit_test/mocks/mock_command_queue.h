@@ -204,6 +204,7 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::commandQueueProperties;
     using BaseClass::commandStream;
     using BaseClass::deferredTimestampPackets;
+    using BaseClass::flushOutOfCsrDependencies;
     using BaseClass::gpgpuEngine;
     using BaseClass::isBlitAuxTranslationRequired;
     using BaseClass::latestSentEnqueueType;
@@ -14,7 +14,17 @@ class MockHostPtrManager : public HostPtrManager {
     using HostPtrManager::checkAllocationsForOverlapping;
     using HostPtrManager::getAllocationRequirements;
     using HostPtrManager::getFragmentAndCheckForOverlaps;
+    using HostPtrManager::getShardIndex;
     using HostPtrManager::populateAlreadyAllocatedFragments;
-    size_t getFragmentCount() { return partialAllocations.size(); }
+    using HostPtrManager::shards;
+    size_t getFragmentCount() {
+        size_t fragmentCount = 0;
+        for (uint32_t i = 0; i < shardsCount; i++) {
+            for (auto &fragment : shards[i].partialAllocations) {
+                fragmentCount += (getShardIndex(fragment.first.ptr) == i) ? 1 : 0;
+            }
+        }
+        return fragmentCount;
+    }
 };
 } // namespace NEO
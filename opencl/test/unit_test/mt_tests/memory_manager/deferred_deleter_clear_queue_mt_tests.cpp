@@ -5,11 +5,15 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_deferrable_deletion.h"
 #include "shared/test/common/mocks/mock_deferred_deleter.h"
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace NEO;
 
 const int threadCount = 4;
@@ -87,11 +91,38 @@ class MyDeferredDeleter : public DeferredDeleter {
     int getClientsNum() {
         return numClients;
     }
+    size_t getAdditionalWorkersCount() {
+        return additionalWorkers.size();
+    }
     void forceSafeStop() {
         safeStop();
     }
 };
 
+class PartitionedDeferrableDeletion : public DeferrableDeletion {
+  public:
+    PartitionedDeferrableDeletion(uint32_t partitionKey, std::atomic<int> &deletionsBeingApplied, std::atomic<int> &deletionsAppliedInParallel)
+        : partitionKey(partitionKey), deletionsBeingApplied(deletionsBeingApplied), deletionsAppliedInParallel(deletionsAppliedInParallel) {}
+
+    bool apply() override {
+        deletionsBeingApplied++;
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (deletionsBeingApplied < 2 && std::chrono::steady_clock::now() < timeout) {
+            std::this_thread::yield();
+        }
+        if (deletionsBeingApplied >= 2) {
+            deletionsAppliedInParallel++;
+        }
+        return true;
+    }
+    uint32_t getPartitionKey() const override { return partitionKey; }
+
+  protected:
+    uint32_t partitionKey;
+    std::atomic<int> &deletionsBeingApplied;
+    std::atomic<int> &deletionsAppliedInParallel;
+};
+
 struct DeferredDeleterMtTest : public ::testing::Test {
 
     void SetUp() override {
@@ -134,3 +165,41 @@ TEST_F(DeferredDeleterMtTest, WhenForcingSafeStopThenDeferredDeleterIsStopped) {
     deleter->removeClient();
     EXPECT_EQ(0, deleter->getClientsNum());
 }
+
+TEST_F(DeferredDeleterMtTest, givenDeferredDeleterWorkersCountSetWhenClientIsAddedThenDeletionsAreReleasedByWorkerPool) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DeferredDeleterWorkersCount.set(3);
+
+    deleter->addClient();
+    EXPECT_TRUE(deleter->isThreadRunning());
+    EXPECT_EQ(2u, deleter->getAdditionalWorkersCount());
+
+    for (int i = 0; i < 100; i++) {
+        deleter->deferDeletion(new MockDeferrableDeletion());
+    }
+    while (deleter->getElementsToRelease() != 0) {
+        std::this_thread::yield();
+    }
+
+    deleter->removeClient();
+    EXPECT_FALSE(deleter->isThreadRunning());
+    EXPECT_EQ(0u, deleter->getAdditionalWorkersCount());
+}
+
+TEST_F(DeferredDeleterMtTest, givenDeferredDeleterWorkersCountSetWhenDeletionsWithDifferentPartitionKeysAreDeferredThenTheyAreReleasedInParallel) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DeferredDeleterWorkersCount.set(2);
+
+    deleter->addClient();
+
+    std::atomic<int> deletionsBeingApplied{0};
+    std::atomic<int> deletionsAppliedInParallel{0};
+    deleter->deferDeletion(new PartitionedDeferrableDeletion(0u, deletionsBeingApplied, deletionsAppliedInParallel));
+    deleter->deferDeletion(new PartitionedDeferrableDeletion(1u, deletionsBeingApplied, deletionsAppliedInParallel));
+    while (deleter->getElementsToRelease() != 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(2, deletionsAppliedInParallel);
+
+    deleter->removeClient();
+}
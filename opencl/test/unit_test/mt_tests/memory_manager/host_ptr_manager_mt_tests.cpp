@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+
+#include "opencl/test/unit_test/mocks/mock_host_ptr_manager.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct HostPtrManagerMtTest : public ::testing::Test {
+    static constexpr uint32_t threadCount = 4u;
+    static constexpr uint32_t iterationsCount = 1000u;
+
+    void SetUp() override {
+        executionEnvironment = new MockExecutionEnvironment(defaultHwInfo.get(), true, threadCount);
+        executionEnvironment->memoryManager.reset(new MockMemoryManager(*executionEnvironment));
+        hostPtrManager = static_cast<MockHostPtrManager *>(executionEnvironment->memoryManager->getHostPtrManager());
+    }
+
+    void TearDown() override {
+        delete executionEnvironment;
+    }
+
+    static void prepareAndReleaseStorage(HostPtrManagerMtTest *test, uint32_t rootDeviceIndex, const void *ptr, size_t size) {
+        while (!test->startThreads) {
+        }
+        auto &memoryManager = *test->executionEnvironment->memoryManager;
+        for (uint32_t i = 0; i < iterationsCount; i++) {
+            auto osStorage = test->hostPtrManager->prepareOsStorageForAllocation(memoryManager, size, ptr, rootDeviceIndex);
+            if (osStorage.fragmentCount == 0) {
+                test->failedPreparations++;
+                continue;
+            }
+            test->hostPtrManager->releaseHandleStorage(rootDeviceIndex, osStorage);
+            memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
+        }
+    }
+
+    void runThreads(const std::vector<std::pair<uint32_t, const void *>> &threadParams, size_t size) {
+        std::vector<std::thread> threads;
+        for (auto &params : threadParams) {
+            threads.push_back(std::thread(prepareAndReleaseStorage, this, params.first, params.second, size));
+        }
+        startThreads = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
+    MockExecutionEnvironment *executionEnvironment = nullptr;
+    MockHostPtrManager *hostPtrManager = nullptr;
+    std::atomic<bool> startThreads{false};
+    std::atomic<uint32_t> failedPreparations{0};
+};
+
+TEST_F(HostPtrManagerMtTest, givenThreadsUsingDifferentRootDevicesWhenPreparingOsStorageConcurrentlyThenAllFragmentsAreReleased) {
+    auto ptr = reinterpret_cast<const void *>(0x100001);
+    std::vector<std::pair<uint32_t, const void *>> threadParams;
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < threadCount; rootDeviceIndex++) {
+        threadParams.push_back({rootDeviceIndex, ptr});
+    }
+
+    runThreads(threadParams, 2 * MemoryConstants::pageSize);
+
+    EXPECT_EQ(0u, failedPreparations);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
+TEST_F(HostPtrManagerMtTest, givenThreadsSharingFragmentsOnOneRootDeviceWhenPreparingOsStorageConcurrentlyThenAllFragmentsAreReleased) {
+    auto ptr = reinterpret_cast<const void *>(0x100001);
+    std::vector<std::pair<uint32_t, const void *>> threadParams;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        threadParams.push_back({0u, ptrOffset(ptr, i * MemoryConstants::pageSize)});
+    }
+
+    runThreads(threadParams, MemoryConstants::pageSize);
+
+    EXPECT_EQ(0u, failedPreparations);
+    EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+}
+
+TEST_F(HostPtrManagerMtTest, givenThreadsPreparingOsStorageForSameHostPtrConcurrentlyWhenFragmentsAreCreatedThenEachFragmentIsStoredOnceAndShared) {
+    auto ptr = reinterpret_cast<const void *>(HostPtrManager::shardRegionSize - MemoryConstants::pageSize - 1);
+    auto size = 2 * MemoryConstants::pageSize;
+    auto &memoryManager = *executionEnvironment->memoryManager;
+
+    for (uint32_t i = 0; i < 100u; i++) {
+        std::array<OsHandleStorage, threadCount> osStorages;
+        std::vector<std::thread> threads;
+        std::atomic<bool> start{false};
+        for (uint32_t thread = 0; thread < threadCount; thread++) {
+            threads.push_back(std::thread([&, thread] {
+                while (!start) {
+                }
+                osStorages[thread] = hostPtrManager->prepareOsStorageForAllocation(memoryManager, size, ptr, 0u);
+            }));
+        }
+        start = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(3u, hostPtrManager->getFragmentCount());
+        for (uint32_t fragment = 0; fragment < osStorages[0].fragmentCount; fragment++) {
+            auto storedFragment = hostPtrManager->getFragment({osStorages[0].fragmentStorageData[fragment].cpuPtr, 0u});
+            ASSERT_NE(nullptr, storedFragment);
+            EXPECT_EQ(static_cast<int>(threadCount), storedFragment->refCount);
+            for (auto &osStorage : osStorages) {
+                EXPECT_EQ(storedFragment->osInternalStorage, osStorage.fragmentStorageData[fragment].osHandleStorage);
+            }
+        }
+
+        for (auto &osStorage : osStorages) {
+            hostPtrManager->releaseHandleStorage(0u, osStorage);
+            memoryManager.cleanOsHandles(osStorage, 0u);
+        }
+        EXPECT_EQ(0u, hostPtrManager->getFragmentCount());
+    }
+}
@@ -160,6 +160,41 @@ TEST(OclocApiTests, WhenGoodFamilyNameIsProvidedThenSuccessIsReturned) {
     EXPECT_EQ(std::string::npos, output.find("Command was: ocloc -file test_files/copybuffer.cl -device "s + argv[4]));
 }
 
+TEST(OclocApiTests, GivenJobsArgumentWhenBuildingFatbinaryThenOutputMatchesSequentialBuild) {
+    const char *argvSequential[] = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        NEO::familyName[NEO::DEFAULT_PLATFORM::hwInfo.platform.eRenderCoreFamily]};
+    const char *argvParallel[] = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        NEO::familyName[NEO::DEFAULT_PLATFORM::hwInfo.platform.eRenderCoreFamily],
+        "-j",
+        "4"};
+
+    testing::internal::CaptureStdout();
+    int retVal = oclocInvoke(sizeof(argvSequential) / sizeof(const char *), argvSequential,
+                             0, nullptr, nullptr, nullptr,
+                             0, nullptr, nullptr, nullptr,
+                             nullptr, nullptr, nullptr, nullptr);
+    std::string sequentialOutput = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(retVal, NEO::OfflineCompiler::ErrorCode::SUCCESS);
+
+    testing::internal::CaptureStdout();
+    retVal = oclocInvoke(sizeof(argvParallel) / sizeof(const char *), argvParallel,
+                         0, nullptr, nullptr, nullptr,
+                         0, nullptr, nullptr, nullptr,
+                         nullptr, nullptr, nullptr, nullptr);
+    std::string parallelOutput = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(retVal, NEO::OfflineCompiler::ErrorCode::SUCCESS);
+
+    EXPECT_EQ(sequentialOutput, parallelOutput);
+}
+
 TEST(OclocApiTests, WhenArgsWithMissingFileAreGivenThenErrorMessageIsProduced) {
     const char *argv[] = {
         "ocloc",
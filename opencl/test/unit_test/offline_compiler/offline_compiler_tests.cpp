@@ -128,6 +128,74 @@ TEST_F(MultiCommandTests, GivenOutputFileWhenBuildingMultiCommandThenSuccessIsRe
 
     deleteFileWithArgs();
 }
+TEST_F(MultiCommandTests, GivenJobsOptionWhenBuildingMultiCommandThenAllBuildsSucceed) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-j",
+        "3",
+        "-q",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get()));
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "gen"));
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+    }
+
+    deleteFileWithArgs();
+}
+TEST_F(MultiCommandTests, GivenSkipDuplicatesOptionWhenBuildingMultiCommandWithIdenticalLinesThenOutputOfFirstBuildIsWrittenForEachLine) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-skip_duplicates",
+        "-q",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 3;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    std::string outDir = OfflineCompiler::getFileNameTrunk(nameOfFileWithArgs);
+    for (int i = 1; i < numOfBuild; i++) {
+        compilerOutputRemove(outDir + "/build_no_" + std::to_string(i + 1), "bin");
+    }
+
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get()));
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (int i = 0; i < numOfBuild; i++) {
+        EXPECT_TRUE(compilerOutputExists(outDir + "/build_no_" + std::to_string(i + 1), "bin"));
+    }
+
+    deleteFileWithArgs();
+}
 TEST_F(MultiCommandTests, GivenSpecifiedOutputDirWhenBuildingMultiCommandThenSuccessIsReturned) {
     nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
     std::vector<std::string> argv = {
@@ -625,6 +693,51 @@ TEST_F(OfflineCompilerTests, GivenInvalidFlagWhenBuildingThenInvalidCommandLineE
     delete pOfflineCompiler;
 }
 
+TEST_F(OfflineCompilerTests, GivenDifferentOutputNamesOrOptionsWhenGettingBuildInputsKeyThenOnlyOptionsChangeTheKey) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-output",
+        "first"};
+
+    std::unique_ptr<OfflineCompiler> first{OfflineCompiler::create(argv.size(), argv, true, retVal, oclocArgHelperWithoutInput.get())};
+    ASSERT_NE(nullptr, first);
+
+    argv[6] = "second";
+    std::unique_ptr<OfflineCompiler> second{OfflineCompiler::create(argv.size(), argv, true, retVal, oclocArgHelperWithoutInput.get())};
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(first->getBuildInputsKey(), second->getBuildInputsKey());
+
+    argv.push_back("-options");
+    argv.push_back("-cl-opt-disable");
+    std::unique_ptr<OfflineCompiler> third{OfflineCompiler::create(argv.size(), argv, true, retVal, oclocArgHelperWithoutInput.get())};
+    ASSERT_NE(nullptr, third);
+    EXPECT_NE(first->getBuildInputsKey(), third->getBuildInputsKey());
+}
+
+TEST_F(OfflineCompilerTests, GivenJobsOptionForSingleTargetWhenBuildingThenInvalidCommandLineErrorIsReturned) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-j",
+        "4"};
+
+    testing::internal::CaptureStdout();
+    pOfflineCompiler = OfflineCompiler::create(argv.size(), argv, true, retVal, oclocArgHelperWithoutInput.get());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("-j option is supported only when compiling fatbinary"));
+    EXPECT_EQ(nullptr, pOfflineCompiler);
+    EXPECT_EQ(OfflineCompiler::ErrorCode::INVALID_COMMAND_LINE, retVal);
+
+    delete pOfflineCompiler;
+}
+
 TEST_F(OfflineCompilerTests, GivenInvalidOptionsWhenBuildingThenInvalidCommandLineErrorIsReturned) {
     std::vector<std::string> argvA = {
         "ocloc",
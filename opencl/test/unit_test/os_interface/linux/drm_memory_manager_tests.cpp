@@ -3425,6 +3425,156 @@ TEST_F(DrmMemoryManagerBasic, givenDrmMemoryManagerWhenAllocateGraphicsMemoryFor
     memoryManager->freeGraphicsMemory(allocation1);
 }
 
+TEST_F(DrmMemoryManagerBasic, givenDefaultSettingsWhenNonSvmHostPtrAllocationIsFreedThenUserptrIsNotCached) {
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false, false, false, executionEnvironment));
+    EXPECT_EQ(0u, memoryManager->userptrCacheCapacity);
+
+    AllocationData allocationData;
+    allocationData.size = 13;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5001);
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_TRUE(memoryManager->userptrCache.empty());
+}
+
+TEST_F(DrmMemoryManagerBasic, givenUserptrCacheEnabledWhenAllocatingNonSvmHostPtrAgainForSameHostMemoryThenCachedBufferObjectAndGpuAddressAreReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrCacheSize.set(4);
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false, false, false, executionEnvironment));
+    memoryManager->msyncFunction = [](void *addr, size_t len, int flags) -> int { return 0; };
+
+    AllocationData allocationData;
+    allocationData.size = 13;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5001);
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    auto gpuAddress = allocation->getGpuAddress();
+
+    memoryManager->freeGraphicsMemory(allocation);
+    ASSERT_EQ(1u, memoryManager->userptrCache.size());
+    EXPECT_EQ(bo, memoryManager->userptrCache.front().bo);
+
+    allocationData.size = 20;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5002);
+    allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(gpuAddress + 1, allocation->getGpuAddress());
+    EXPECT_EQ(reinterpret_cast<void *>(bo->peekAddress()), allocation->getReservedAddressPtr());
+    EXPECT_TRUE(memoryManager->userptrCache.empty());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, memoryManager->userptrCache.size());
+}
+
+TEST_F(DrmMemoryManagerBasic, givenUserptrCacheEnabledWhenCachedHostMemoryIsUnmappedThenNewBufferObjectIsCreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrCacheSize.set(4);
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false, false, false, executionEnvironment));
+    memoryManager->msyncFunction = [](void *addr, size_t len, int flags) -> int { return -1; };
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5000);
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, memoryManager->userptrCache.size());
+
+    allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_TRUE(memoryManager->userptrCache.empty());
+    EXPECT_NE(nullptr, allocation->getBO());
+    EXPECT_EQ(1u, allocation->getBO()->getRefCount());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerBasic, givenUserptrCacheWithLimitedSizeWhenMoreAllocationsAreFreedThenLeastRecentlyUsedEntryIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrCacheSize.set(1);
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false, false, false, executionEnvironment));
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5000);
+    auto allocation0 = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x7000);
+    auto allocation1 = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation0);
+    ASSERT_NE(nullptr, allocation1);
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation1);
+
+    ASSERT_EQ(1u, memoryManager->userptrCache.size());
+    EXPECT_EQ(0x7000u, memoryManager->userptrCache.front().address);
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenUserptrCacheAndHostMemoryValidationEnabledWhenCachedBufferObjectIsReusedThenHostMemoryIsValidatedAgain) {
+    class PinBufferObject : public BufferObject {
+      public:
+        PinBufferObject(Drm *drm) : BufferObject(drm, 1, 0, 1) {
+        }
+
+        int validateHostPtr(BufferObject *const boToPin[], size_t numberOfBos, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId) override {
+            validatedBo = boToPin[0];
+            validateHostPtrCalled++;
+            return validateHostPtrResult;
+        }
+        BufferObject *validatedBo = nullptr;
+        uint32_t validateHostPtrCalled = 0u;
+        int validateHostPtrResult = 0;
+    };
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrCacheSize.set(4);
+    std::unique_ptr<TestedDrmMemoryManager> memoryManager(new TestedDrmMemoryManager(false, false, true, *executionEnvironment));
+    memoryManager->msyncFunction = [](void *addr, size_t len, int flags) -> int { return 0; };
+    memoryManager->registeredEngines = EngineControlContainer{this->device->engines};
+    for (auto engine : memoryManager->registeredEngines) {
+        engine.osContext->incRefInternal();
+    }
+
+    PinBufferObject *pinBB = new PinBufferObject(this->mock);
+    memoryManager->injectPinBB(pinBB, rootDeviceIndex);
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.hostPtr = reinterpret_cast<const void *>(0x5000);
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = allocation->getBO();
+    EXPECT_EQ(1u, pinBB->validateHostPtrCalled);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    ASSERT_EQ(1u, memoryManager->userptrCache.size());
+
+    allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, allocation->getBO());
+    EXPECT_EQ(2u, pinBB->validateHostPtrCalled);
+    EXPECT_EQ(bo, pinBB->validatedBo);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    ASSERT_EQ(1u, memoryManager->userptrCache.size());
+
+    pinBB->validateHostPtrResult = EFAULT;
+    allocation = memoryManager->allocateGraphicsMemoryForNonSvmHostPtr(allocationData);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(3u, pinBB->validateHostPtrCalled);
+    EXPECT_TRUE(memoryManager->userptrCache.empty());
+}
+
 TEST_F(DrmMemoryManagerBasic, givenDrmMemoryManagerWhenAllocateGraphicsMemoryForNonSvmHostPtrIsCalledButAllocationFailedThenNullPtrReturned) {
     AllocationData allocationData;
     allocationData.rootDeviceIndex = rootDeviceIndex;
@@ -89,6 +89,31 @@ TEST_F(PrintfHandlerTests, givenPreparedPrintfHandlerWithUndefinedSshOffsetWhenG
     delete device;
 }
 
+TEST_F(PrintfHandlerTests, givenAllocatedSurfaceWhenPreparingDispatchThenSurfaceIsReusedAndPatchedIntoKernel) {
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+
+    auto kernelInfo = std::make_unique<MockKernelInfo>();
+    kernelInfo->setPrintfSurface(sizeof(uintptr_t), 0);
+
+    auto program = std::make_unique<MockProgram>(&context, false, toClDeviceVector(*device));
+
+    uint64_t crossThread[10] = {};
+    auto kernel = std::make_unique<MockKernel>(program.get(), *kernelInfo, *device);
+    kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+
+    MockMultiDispatchInfo multiDispatchInfo(device.get(), kernel.get());
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+    printfHandler->allocateSurface();
+    auto surface = printfHandler->getSurface();
+    ASSERT_NE(nullptr, surface);
+    EXPECT_EQ(0u, *reinterpret_cast<uintptr_t *>(kernel->getCrossThreadData()));
+
+    printfHandler->prepareDispatch(multiDispatchInfo);
+    EXPECT_EQ(surface, printfHandler->getSurface());
+    EXPECT_EQ(static_cast<uintptr_t>(surface->getGpuAddressToPatch()), *reinterpret_cast<uintptr_t *>(kernel->getCrossThreadData()));
+}
+
 HWTEST_F(PrintfHandlerTests, givenEnabledStatelessCompressionWhenPrintEnqueueOutputIsCalledThenBCSEngineIsUsedToDecompressPrintfOutput) {
     HardwareInfo hwInfo = *defaultHwInfo;
     hwInfo.capabilityTable.blitterOperationsSupported = true;
@@ -10,25 +10,34 @@
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <unordered_map>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+void MultiCommand::prepareBuild(BuildJob &job) {
+    if (requestedFatBinary(job.args, argHelper)) {
+        job.fatBinary = true;
+        return;
+    }
+
     int retVal = OfflineCompiler::ErrorCode::SUCCESS;
+    job.compiler.reset(OfflineCompiler::create(job.args.size(), job.args, true, retVal, argHelper));
+    job.retVal = retVal;
+    job.outFileName += ".bin";
+}
 
-    if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
-    } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
-        if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+void MultiCommand::finalizeBuild(BuildJob &job, std::vector<std::string> &outputEntries) {
+    int retVal = job.retVal;
 
-            std::string &buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
-            }
+    if (job.fatBinary) {
+        retVal = buildFatBinary(job.args, argHelper);
+    } else if (job.compiler) {
+        std::string &buildLog = job.compiler->getBuildLog();
+        if (buildLog.empty() == false) {
+            argHelper->printf("%s\n", buildLog.c_str());
         }
-        outFileName += ".bin";
     }
     if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
         if (!quiet)
@@ -38,13 +47,13 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        outputEntries[job.lineId] = getCurrentDirectoryOwn(outDirForBuilds) + job.outFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        outputEntries[job.lineId] = "Unsuccesful build";
     }
-    outputFile << '\n';
+    outputFile << outputEntries[job.lineId] << '\n';
 
-    return retVal;
+    job.retVal = retVal;
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
@@ -102,6 +111,10 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            jobs = static_cast<size_t>(std::max(1, atoi(args[++argIndex].c_str())));
+        } else if (ConstStringRef("-skip_duplicates") == currArg) {
+            skipDuplicates = true;
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -132,22 +145,88 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
-    for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+    std::vector<std::string> outputEntries(lines.size());
+    std::unordered_map<std::string, size_t> firstOccurrences;
+    std::unordered_map<size_t, std::unique_ptr<OfflineCompiler>> firstOccurrenceCompilers;
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OfflineCompiler::ErrorCode::SUCCESS) {
-            retValues.push_back(retVal);
-            continue;
+    //lines are built in batches of "jobs" size, logs and results are reported in line order
+    for (size_t batchStart = 0; batchStart < lines.size(); batchStart += jobs) {
+        auto batchEnd = std::min(batchStart + jobs, lines.size());
+
+        std::vector<BuildJob> batch(batchEnd - batchStart);
+        std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+        std::vector<size_t> compiledJobs;
+        for (auto i = batchStart; i < batchEnd; ++i) {
+            auto &job = batch[i - batchStart];
+            job.lineId = i;
+            job.args = {argZero};
+
+            OclocArgHelper::setThreadMessagesBuffer(&job.log);
+            job.retVal = splitLineInSeparateArgs(job.args, lines[i], i);
+            if (job.retVal == OfflineCompiler::ErrorCode::SUCCESS) {
+                job.validArgs = true;
+                if (!quiet) {
+                    argHelper->printf("Command numer %zu: \n", i + 1);
+                }
+
+                addAdditionalOptionsToSingleCommandLine(job.args, i);
+                job.outFileName = outFileName;
+                prepareBuild(job);
+            }
+            OclocArgHelper::setThreadMessagesBuffer(nullptr);
+
+            if (!job.compiler || job.retVal != OfflineCompiler::ErrorCode::SUCCESS) {
+                continue;
+            }
+            //fatbinaries are built and written out by buildFatBinary, so they are never treated as duplicates
+            if (skipDuplicates) {
+                auto buildKey = job.compiler->getBuildInputsKey();
+                auto firstOccurrence = firstOccurrences.find(buildKey);
+                if (firstOccurrence != firstOccurrences.end()) {
+                    job.duplicateOf = firstOccurrence->second;
+                    continue;
+                }
+                firstOccurrences.insert({buildKey, i});
+            }
+            compilers.push_back(std::move(job.compiler));
+            compiledJobs.push_back(i - batchStart);
         }
 
-        if (!quiet) {
-            argHelper->printf("Command numer %zu: \n", i + 1);
+        if (compilers.empty() == false) {
+            std::vector<int> buildResults(compilers.size(), 0);
+            std::vector<std::string> buildMessages(compilers.size());
+            buildTargetsInParallel(compilers, buildResults, buildMessages);
+            for (size_t compilerId = 0; compilerId < compilers.size(); compilerId++) {
+                auto &job = batch[compiledJobs[compilerId]];
+                job.compiler = std::move(compilers[compilerId]);
+                job.retVal = buildResults[compilerId];
+                job.log += buildMessages[compilerId];
+            }
         }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+        for (auto &job : batch) {
+            argHelper->printf(job.log.c_str());
+            if (job.duplicateOf != std::numeric_limits<size_t>::max()) {
+                if (!quiet) {
+                    argHelper->printf("Command numer %zu: same as command numer %zu, build skipped.\n", job.lineId + 1, job.duplicateOf + 1);
+                }
+                job.retVal = retValues[job.duplicateOf];
+                if (job.retVal == OfflineCompiler::ErrorCode::SUCCESS) {
+                    //outputs of the first build are written out under names of this line
+                    firstOccurrenceCompilers[job.duplicateOf]->writeOutAllFilesAs(*job.compiler);
+                    outputEntries[job.lineId] = getCurrentDirectoryOwn(outDirForBuilds) + job.outFileName;
+                } else {
+                    outputEntries[job.lineId] = outputEntries[job.duplicateOf];
+                }
+                outputFile << outputEntries[job.lineId] << '\n';
+            } else if (job.validArgs) {
+                finalizeBuild(job, outputEntries);
+                if (skipDuplicates && job.compiler) {
+                    firstOccurrenceCompilers[job.lineId] = std::move(job.compiler);
+                }
+            }
+            retValues.push_back(job.retVal);
+        }
     }
 }
 
@@ -166,6 +245,16 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run in parallel.
+                                Logs and results are still reported
+                                in the order of lines in <file_name>.
+                                Default is 1.
+
+  -skip_duplicates              Skips builds with the same input contents
+                                and effective options as one of the
+                                previous lines, outputs of the first such
+                                build are written under their own names.
+
 )===");
 }
 
@@ -15,6 +15,8 @@
 #include <CL/cl.h>
 
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <sstream>
 
 namespace NEO {
@@ -31,12 +33,25 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct BuildJob {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::string log;
+        std::unique_ptr<OfflineCompiler> compiler;
+        size_t lineId = 0u;
+        size_t duplicateOf = std::numeric_limits<size_t>::max();
+        int retVal = OfflineCompiler::ErrorCode::SUCCESS;
+        bool fatBinary = false;
+        bool validArgs = false;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    int singleBuild(const std::vector<std::string> &args);
+    void prepareBuild(BuildJob &job);
+    void finalizeBuild(BuildJob &job, std::vector<std::string> &outputEntries);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
@@ -47,6 +62,8 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    size_t jobs = 1u;
     bool quiet = false;
+    bool skipDuplicates = false;
 };
 } // namespace NEO
@@ -17,6 +17,8 @@
 #include <cstring>
 #include <sstream>
 
+thread_local std::string *OclocArgHelper::threadMessagesBuffer = nullptr;
+
 void Source::toVectorOfStrings(std::vector<std::string> &lines, bool replaceTabs) {
     std::string line;
     const char *file = reinterpret_cast<const char *>(data);
@@ -152,6 +154,7 @@ std::unique_ptr<char[]> OclocArgHelper::loadDataFromFile(const std::string &file
 }
 
 void OclocArgHelper::saveOutput(const std::string &filename, const void *pData, const size_t &dataSize) {
+    std::lock_guard<std::mutex> lock(outputMutex);
     if (outputEnabled()) {
         addOutput(filename, pData, dataSize);
     } else {
@@ -162,6 +165,7 @@ void OclocArgHelper::saveOutput(const std::string &filename, const void *pData,
 void OclocArgHelper::saveOutput(const std::string &filename, const std::ostream &stream) {
     std::stringstream ss;
     ss << stream.rdbuf();
+    std::lock_guard<std::mutex> lock(outputMutex);
     if (outputEnabled()) {
         addOutput(filename, ss.str().c_str(), ss.str().length());
     } else {
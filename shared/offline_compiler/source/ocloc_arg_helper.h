@@ -10,9 +10,11 @@
 #include "hw_cmds.h"
 
 #include <cctype>
+#include <cstdio>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -57,6 +59,9 @@ class OclocArgHelper {
     std::map<std::string, unsigned int> genIGFXMap;
     void moveOutputs();
     MessagePrinter messagePrinter;
+    std::mutex printMutex;
+    static thread_local std::string *threadMessagesBuffer;
+    std::mutex outputMutex;
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
@@ -97,12 +102,33 @@ class OclocArgHelper {
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
+        if (threadMessagesBuffer) {
+            threadMessagesBuffer->append(message);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        if (threadMessagesBuffer) {
+            auto size = snprintf(nullptr, 0, format, args...);
+            if (size > 0) {
+                std::string message(static_cast<size_t>(size) + 1, '\0');
+                snprintf(&message[0], message.size(), format, args...);
+                message.resize(static_cast<size_t>(size));
+                threadMessagesBuffer->append(message);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(format, std::forward<Args>(args)...);
     }
+
+    // while set, messages printed from the calling thread are appended to the buffer instead of being printed
+    static void setThreadMessagesBuffer(std::string *buffer) {
+        threadMessagesBuffer = buffer;
+    }
     std::string returnProductNameForDevice(unsigned short deviceId);
     bool isGen(const std::string &device);
     unsigned int returnIGFXforGen(const std::string &device);
@@ -17,9 +17,13 @@
 #include "compiler_options.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
 
 namespace NEO {
 
@@ -191,12 +195,37 @@ std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef device
     return toProductNames(requestedPlatforms);
 }
 
+void buildTargetsInParallel(std::vector<std::unique_ptr<OfflineCompiler>> &compilers, std::vector<int> &buildResults, std::vector<std::string> &buildMessages) {
+    //messages of each build are buffered, so that callers can report them in order
+    auto buildWithBufferedMessages = [&compilers, &buildResults, &buildMessages](size_t i) {
+        OclocArgHelper::setThreadMessagesBuffer(&buildMessages[i]);
+        buildResults[i] = buildWithSafetyGuard(compilers[i].get());
+        OclocArgHelper::setThreadMessagesBuffer(nullptr);
+    };
+
+    if (compilers.size() == 1) {
+        buildWithBufferedMessages(0);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(compilers.size());
+    for (size_t i = 0; i < compilers.size(); i++) {
+        workers.emplace_back(buildWithBufferedMessages, i);
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
     std::string inputFileName = "";
     std::string outputFileName = "";
     std::string outputDirectory = "";
+    size_t jobs = 1u;
+    std::vector<size_t> jobsArgIndices;
 
     std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
@@ -218,32 +247,59 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
             outputDirectory = args[argIndex + 1];
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            jobs = static_cast<size_t>(std::max(1, atoi(args[argIndex + 1].c_str())));
+            jobsArgIndices.push_back(argIndex);
+            ++argIndex;
+        }
+    }
+
+    //-j is consumed here, compilers of single targets don't accept it
+    for (auto it = jobsArgIndices.rbegin(); it != jobsArgIndices.rend(); it++) {
+        argsCopy.erase(argsCopy.begin() + *it, argsCopy.begin() + *it + 2);
+        if (deviceArgIndex > *it) {
+            deviceArgIndex -= 2;
         }
     }
 
     std::vector<ConstStringRef> targetPlatforms;
-    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetPlatforms = getTargetPlatformsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetPlatforms.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
 
     NEO::Ar::ArEncoder fatbinary(true);
 
-    for (auto targetPlatform : targetPlatforms) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
+    //targets are built in batches of "jobs" size, entries are appended in target order to keep the archive deterministic
+    for (size_t batchStart = 0; batchStart < targetPlatforms.size(); batchStart += jobs) {
+        auto batchEnd = std::min(batchStart + jobs, targetPlatforms.size());
+
+        std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+        for (auto targetId = batchStart; targetId < batchEnd; targetId++) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = targetPlatforms[targetId].str();
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+            compilers.push_back(std::move(pCompiler));
         }
 
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
-        if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+        std::vector<int> buildResults(compilers.size(), 0);
+        std::vector<std::string> buildMessages(compilers.size());
+        buildTargetsInParallel(compilers, buildResults, buildMessages);
+
+        for (size_t compilerId = 0; compilerId < compilers.size(); compilerId++) {
+            auto &pCompiler = compilers[compilerId];
+            auto targetPlatform = targetPlatforms[batchStart + compilerId];
+            auto retVal = buildResults[compilerId];
+            argsCopy[deviceArgIndex] = targetPlatform.str();
 
+            auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
+            argHelper->printf(buildMessages[compilerId].c_str());
             std::string buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
                 argHelper->printf("%s\n", buildLog.c_str());
@@ -258,14 +314,11 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
                 for (const auto &arg : argsCopy)
                     argHelper->printf(" %s", arg.c_str());
                 argHelper->printf("\n");
+                return retVal;
             }
-        }
 
-        if (0 != retVal) {
-            return retVal;
+            fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
         }
-
-        fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
     }
 
     auto fatbinaryData = fatbinary.encode();
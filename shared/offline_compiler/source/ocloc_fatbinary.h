@@ -11,11 +11,13 @@
 
 #include "igfxfmid.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 class OclocArgHelper;
 namespace NEO {
+class OfflineCompiler;
 
 bool requestedFatBinary(const std::vector<std::string> &args, OclocArgHelper *helper);
 inline bool requestedFatBinary(int argc, const char *argv[], OclocArgHelper *helper) {
@@ -36,5 +38,6 @@ std::vector<ConstStringRef> toProductNames(const std::vector<PRODUCT_FAMILY> &pr
 PRODUCT_FAMILY asProductId(ConstStringRef product, const std::vector<PRODUCT_FAMILY> &allSupportedPlatforms);
 void appendPlatformsForGfxCore(GFXCORE_FAMILY core, const std::vector<PRODUCT_FAMILY> &allSupportedPlatforms, std::vector<PRODUCT_FAMILY> &out);
 std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
+void buildTargetsInParallel(std::vector<std::unique_ptr<OfflineCompiler>> &compilers, std::vector<int> &buildResults, std::vector<std::string> &buildMessages);
 
 } // namespace NEO
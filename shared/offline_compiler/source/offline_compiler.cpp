@@ -17,6 +17,7 @@
 #include "shared/source/helpers/compiler_options_parser.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
@@ -687,6 +688,10 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
         } else if (("-revision_id" == currArg) && hasMoreArgs) {
             revisionId = std::stoi(argv[argIndex + 1], nullptr, 0);
             argIndex++;
+        } else if ("-j" == currArg) {
+            argHelper->printf("Error: -j option is supported only when compiling fatbinary or in multi command mode\n");
+            retVal = INVALID_COMMAND_LINE;
+            break;
         } else {
             argHelper->printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = INVALID_COMMAND_LINE;
@@ -836,7 +841,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [-j <jobs>] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -951,6 +956,11 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -revision_id <revision_id>    Target stepping. Can be decimal or hexadecimal value.
 
+  -j <jobs>                     Number of targets built in parallel when
+                                compiling fatbinary. Default is 1.
+                                Not allowed when compiling for a single
+                                target.
+
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
@@ -996,6 +1006,7 @@ bool OfflineCompiler::generateElfBinary() {
 
     using namespace NEO::Elf;
     ElfEncoder<EI_CLASS_64> ElfEncoder;
+    ElfEncoder.setReferenceExternalData(true);
     ElfEncoder.getElfFileHeader().type = ET_OPENCL_EXECUTABLE;
     if (binary.buildOptions.empty() == false) {
         ElfEncoder.appendSection(SHT_OPENCL_OPTIONS, SectionNamesOpenCl::buildOptions,
@@ -1023,6 +1034,34 @@ bool OfflineCompiler::generateElfBinary() {
     return true;
 }
 
+std::string OfflineCompiler::getBuildInputsKey() const {
+    std::string key = familyNameWithType + "." + std::to_string(hwInfo.platform.usRevId) + "\n";
+    key += options + "\n" + internalOptions + "\n";
+    for (auto flag : {useLlvmText, useLlvmBc, useCppFile, onlySpirV, inputFileLlvm, inputFileSpirV, forceStatelessToStatefulOptimization}) {
+        key += flag ? '1' : '0';
+    }
+    key += "\n" + std::to_string(sourceCode.size()) + "." + std::to_string(Hash::hash(sourceCode.c_str(), sourceCode.size()));
+    return key;
+}
+
+void OfflineCompiler::writeOutAllFilesAs(const OfflineCompiler &other) {
+    auto ownOutputFile = outputFile;
+    auto ownOutputDirectory = outputDirectory;
+    auto ownOutputNoSuffix = outputNoSuffix;
+    auto ownUseOptionsSuffix = useOptionsSuffix;
+    outputFile = other.outputFile;
+    outputDirectory = other.outputDirectory;
+    outputNoSuffix = other.outputNoSuffix;
+    useOptionsSuffix = other.useOptionsSuffix;
+
+    writeOutAllFiles();
+
+    outputFile = ownOutputFile;
+    outputDirectory = ownOutputDirectory;
+    outputNoSuffix = ownOutputNoSuffix;
+    useOptionsSuffix = ownUseOptionsSuffix;
+}
+
 void OfflineCompiler::writeOutAllFiles() {
     std::string fileBase;
     std::string fileTrunk = getFileNameTrunk(inputFile);
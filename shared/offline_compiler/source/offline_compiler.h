@@ -87,6 +87,11 @@ class OfflineCompiler {
         return hwInfo;
     }
 
+    // identifies the build by its inputs and effective options, output names are not included
+    std::string getBuildInputsKey() const;
+    // writes outputs of this build under output names of the other compiler
+    void writeOutAllFilesAs(const OfflineCompiler &other);
+
   protected:
     OfflineCompiler();
 
@@ -8,18 +8,26 @@
 #pragma once
 #include "shared/source/helpers/abort.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
+// per thread, so that guarded calls may run on several threads at once
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
-        struct sigaction sigact;
+        // signal handlers are process wide, they are installed by the first active guard and restored by the last one
+        std::lock_guard<std::mutex> lock(getHandlersMutex());
+        if (activeGuards++ > 0) {
+            return;
+        }
+        struct sigaction sigact = {};
 
         sigact.sa_sigaction = sigAction;
         sigact.sa_flags = SA_RESTART | SA_SIGINFO;
@@ -28,6 +36,10 @@ class SafetyGuardLinux {
     }
 
     ~SafetyGuardLinux() {
+        std::lock_guard<std::mutex> lock(getHandlersMutex());
+        if (--activeGuards > 0) {
+            return;
+        }
         if (previousSigSegvAction.sa_sigaction) {
             sigaction(SIGSEGV, &previousSigSegvAction, NULL);
         }
@@ -72,6 +84,14 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction = {};
-    struct sigaction previousSigIllvAction = {};
+
+  protected:
+    static std::mutex &getHandlersMutex() {
+        static std::mutex handlersMutex;
+        return handlersMutex;
+    }
+
+    static inline uint32_t activeGuards = 0u;
+    static inline struct sigaction previousSigSegvAction = {};
+    static inline struct sigaction previousSigIllvAction = {};
 };
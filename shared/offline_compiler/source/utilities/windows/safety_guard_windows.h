@@ -11,7 +11,8 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
+// per thread, so that guarded calls may run on several threads at once
+static thread_local jmp_buf jmpbuf;
 
 class SafetyGuardWindows {
   public:
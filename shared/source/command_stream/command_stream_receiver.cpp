@@ -44,6 +44,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 
     latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     submissionAggregator.reset(new SubmissionAggregator());
+    setupSubmissionBudget();
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
@@ -696,6 +697,30 @@ void CommandStreamReceiver::checkForNewResources(uint32_t submittedTaskCount, ui
     }
 }
 
+void CommandStreamReceiver::setupSubmissionBudget() {
+    int32_t maxCommandBuffers = SubmissionAggregator::defaultMaxCommandBuffers;
+    int64_t maxCommandBufferSize = SubmissionAggregator::defaultMaxCommandBufferSize;
+    int64_t maxLatency = SubmissionAggregator::defaultMaxLatencyUs;
+
+    if (DebugManager.flags.BatchedDispatchMaxCommandBuffers.get() != -1) {
+        maxCommandBuffers = DebugManager.flags.BatchedDispatchMaxCommandBuffers.get();
+    }
+    if (DebugManager.flags.BatchedDispatchMaxCommandBufferSize.get() != -1) {
+        maxCommandBufferSize = DebugManager.flags.BatchedDispatchMaxCommandBufferSize.get();
+    }
+    if (DebugManager.flags.BatchedDispatchMaxLatency.get() != -1) {
+        maxLatency = DebugManager.flags.BatchedDispatchMaxLatency.get();
+    }
+    submissionAggregator->setSubmissionBudget(static_cast<uint32_t>(maxCommandBuffers), static_cast<size_t>(maxCommandBufferSize), std::chrono::microseconds(maxLatency));
+}
+
+bool CommandStreamReceiver::checkImplicitFlushForSubmissionBudget() {
+    if (this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) {
+        return submissionAggregator->isSubmissionBudgetExhausted();
+    }
+    return false;
+}
+
 bool CommandStreamReceiver::checkImplicitFlushForGpuIdle() {
     if (useGpuIdleImplicitFlush) {
         if (this->taskCount == *getTagAddress()) {
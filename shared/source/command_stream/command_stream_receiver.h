@@ -59,7 +59,7 @@ enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
     AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
-    BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
+    BatchedDispatchWithCounter, //dispatching is batched, implicit flush when submission budget is exhausted
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
 
@@ -138,6 +138,7 @@ class CommandStreamReceiver {
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    bool isBatchedDispatchMode() const { return dispatchMode == DispatchMode::BatchedDispatch || dispatchMode == DispatchMode::BatchedDispatchWithCounter; }
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
     bool getMediaVFEStateDirty() { return mediaVfeStateDirty; }
@@ -272,6 +273,8 @@ class CommandStreamReceiver {
     void printDeviceIndex();
     void checkForNewResources(uint32_t submittedTaskCount, uint32_t allocationTaskCount, GraphicsAllocation &gfxAllocation);
     bool checkImplicitFlushForGpuIdle();
+    bool checkImplicitFlushForSubmissionBudget();
+    void setupSubmissionBudget();
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
@@ -622,8 +622,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         this->newResources = false;
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
+    implicitFlush |= checkImplicitFlushForSubmissionBudget();
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && implicitFlush) {
+    if (this->isBatchedDispatchMode() && implicitFlush) {
         this->flushBatchedSubmissions();
     }
 
@@ -11,9 +11,40 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (this->cmdBuffers.peekIsEmpty()) {
+        this->oldestRecordTimestamp = std::chrono::steady_clock::now();
+        this->pendingCommandBuffers = 0u;
+        this->pendingCommandBufferSize = 0u;
+    }
+    this->pendingCommandBuffers++;
+    if (commandBuffer->batchBuffer.usedSize > commandBuffer->batchBuffer.startOffset) {
+        this->pendingCommandBufferSize += commandBuffer->batchBuffer.usedSize - commandBuffer->batchBuffer.startOffset;
+    }
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+void NEO::SubmissionAggregator::setSubmissionBudget(uint32_t maxCommandBuffers, size_t maxCommandBufferSize, std::chrono::microseconds maxLatency) {
+    this->maxCommandBuffers = maxCommandBuffers;
+    this->maxCommandBufferSize = maxCommandBufferSize;
+    this->maxLatency = maxLatency;
+}
+
+bool NEO::SubmissionAggregator::isSubmissionBudgetExhausted() {
+    if (this->cmdBuffers.peekIsEmpty()) {
+        return false;
+    }
+    if (this->maxCommandBuffers != 0u && this->pendingCommandBuffers >= this->maxCommandBuffers) {
+        return true;
+    }
+    if (this->maxCommandBufferSize != 0u && this->pendingCommandBufferSize >= this->maxCommandBufferSize) {
+        return true;
+    }
+    if (this->maxLatency.count() != 0) {
+        return std::chrono::steady_clock::now() - this->oldestRecordTimestamp >= this->maxLatency;
+    }
+    return false;
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
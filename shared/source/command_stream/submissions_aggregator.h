@@ -12,6 +12,7 @@
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -69,12 +70,30 @@ using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
 class SubmissionAggregator {
   public:
+    static constexpr uint32_t defaultMaxCommandBuffers = 64u;
+    static constexpr size_t defaultMaxCommandBufferSize = 256 * 1024u;
+    static constexpr int64_t defaultMaxLatencyUs = 500;
+
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    //zero disables given limit
+    void setSubmissionBudget(uint32_t maxCommandBuffers, size_t maxCommandBufferSize, std::chrono::microseconds maxLatency);
+    bool isSubmissionBudgetExhausted();
+    uint32_t peekPendingCommandBuffers() const { return pendingCommandBuffers; }
+    size_t peekPendingCommandBufferSize() const { return pendingCommandBufferSize; }
+
   protected:
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+
+    std::chrono::steady_clock::time_point oldestRecordTimestamp = {};
+    uint32_t pendingCommandBuffers = 0u;
+    size_t pendingCommandBufferSize = 0u;
+
+    uint32_t maxCommandBuffers = 0u;
+    size_t maxCommandBufferSize = 0u;
+    std::chrono::microseconds maxLatency{0};
 };
 } // namespace NEO
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/build_worker_pool.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+BuildWorkerPool::BuildWorkerPool(uint32_t maxWorkers) : maxWorkers(std::max(1U, maxWorkers)), state(std::make_shared<State>()) {
+}
+
+BuildWorkerPool::~BuildWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        state->stopping = true;
+    }
+    state->taskAvailable.notify_all();
+    for (auto &worker : workers) {
+        // a task may drop the last reference to the pool owner from within a worker
+        if (worker.get_id() == std::this_thread::get_id()) {
+            worker.detach();
+        } else {
+            worker.join();
+        }
+    }
+}
+
+uint32_t BuildWorkerPool::getDefaultWorkersCount() {
+    if (DebugManager.flags.AsyncBuildWorkerThreads.get() > 0) {
+        return static_cast<uint32_t>(DebugManager.flags.AsyncBuildWorkerThreads.get());
+    }
+    constexpr uint32_t maxDefaultWorkersCount = 4U;
+    return std::min(maxDefaultWorkersCount, std::max(1U, std::thread::hardware_concurrency()));
+}
+
+void BuildWorkerPool::submit(Task task) {
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->tasks.push_back(std::move(task));
+    // threads are spawned lazily, only when all existing ones are busy
+    if ((state->waitingWorkers < state->tasks.size()) && (workers.size() < maxWorkers)) {
+        workers.emplace_back(&BuildWorkerPool::run, state);
+    }
+    lock.unlock();
+    state->taskAvailable.notify_one();
+}
+
+void BuildWorkerPool::waitForIdle() {
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->idle.wait(lock, [this] { return state->tasks.empty() && (0U == state->busyWorkers); });
+}
+
+void BuildWorkerPool::run(std::shared_ptr<State> state) {
+    std::unique_lock<std::mutex> lock(state->mtx);
+    while (true) {
+        ++state->waitingWorkers;
+        state->taskAvailable.wait(lock, [&state] { return state->stopping || (false == state->tasks.empty()); });
+        --state->waitingWorkers;
+        // pending builds are finished before the pool goes away
+        if (state->tasks.empty()) {
+            return;
+        }
+        auto task = std::move(state->tasks.front());
+        state->tasks.pop_front();
+        ++state->busyWorkers;
+        lock.unlock();
+        task();
+        task = nullptr;
+        lock.lock();
+        --state->busyWorkers;
+        if (state->tasks.empty() && (0U == state->busyWorkers)) {
+            state->idle.notify_all();
+        }
+    }
+}
+
+} // namespace NEO
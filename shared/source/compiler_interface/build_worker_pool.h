@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+class BuildWorkerPool {
+  public:
+    using Task = std::function<void()>;
+
+    BuildWorkerPool(uint32_t maxWorkers);
+    ~BuildWorkerPool();
+
+    BuildWorkerPool(const BuildWorkerPool &) = delete;
+    BuildWorkerPool &operator=(const BuildWorkerPool &) = delete;
+
+    static uint32_t getDefaultWorkersCount();
+
+    void submit(Task task);
+    void waitForIdle();
+
+    uint32_t getMaxWorkersCount() const {
+        return maxWorkers;
+    }
+
+    size_t getWorkersCount() {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        return workers.size();
+    }
+
+  protected:
+    // kept alive by every worker, a worker detached from the destructor may still be running
+    struct State {
+        std::mutex mtx;
+        std::condition_variable taskAvailable;
+        std::condition_variable idle;
+        std::deque<Task> tasks;
+        uint32_t busyWorkers = 0U;
+        uint32_t waitingWorkers = 0U;
+        bool stopping = false;
+    };
+
+    static void run(std::shared_ptr<State> state);
+
+    const uint32_t maxWorkers;
+    std::shared_ptr<State> state;
+    std::vector<std::thread> workers;
+};
+
+} // namespace NEO
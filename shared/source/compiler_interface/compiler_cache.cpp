@@ -11,21 +11,223 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/const_stringref.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace NEO {
+namespace {
+constexpr size_t maxIncludeDependencies = 256U;
+constexpr const char *includeManifestHeader = "NEO include manifest v1\n";
+
+struct IncludeDirective {
+    std::string name;
+    bool quoted = false;
+};
+
+std::string toHashString(uint64_t hash) {
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(hash) * 2)
+           << std::hex
+           << hash;
+    return stream.str();
+}
+
+std::string getDirectory(const std::string &path) {
+    auto separatorPos = path.find_last_of("/\\");
+    return (std::string::npos == separatorPos) ? std::string{} : path.substr(0, separatorPos + 1);
+}
+
+bool isAbsolutePath(const std::string &path) {
+    return (false == path.empty()) && ((path[0] == '/') || (path[0] == '\\') || ((path.size() > 1) && (path[1] == ':')));
+}
+
+std::vector<std::string> tokenizeOptions(ArrayRef<const char> options) {
+    std::vector<std::string> tokens;
+    std::string token;
+    bool inQuotes = false;
+    for (auto c : options) {
+        if (c == '"') {
+            inQuotes = !inQuotes;
+        } else if ((false == inQuotes) && std::isspace(static_cast<unsigned char>(c))) {
+            if (false == token.empty()) {
+                tokens.push_back(std::move(token));
+                token.clear();
+            }
+        } else if (c != '\0') {
+            token += c;
+        }
+    }
+    if (false == token.empty()) {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+std::vector<std::string> getIncludeDirs(const std::vector<std::string> &tokens) {
+    std::vector<std::string> includeDirs;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if (tokens[i] == "-I") {
+            if (i + 1 < tokens.size()) {
+                includeDirs.push_back(tokens[++i]);
+            }
+        } else if (0 == tokens[i].compare(0, 2, "-I")) {
+            includeDirs.push_back(tokens[i].substr(2));
+        }
+    }
+    return includeDirs;
+}
+
+std::vector<IncludeDirective> getForcedIncludes(const std::vector<std::string> &tokens) {
+    std::vector<IncludeDirective> forcedIncludes;
+    for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+        if (tokens[i] == "-include") {
+            IncludeDirective directive;
+            directive.name = tokens[++i];
+            directive.quoted = true;
+            forcedIncludes.push_back(std::move(directive));
+        }
+    }
+    return forcedIncludes;
+}
+
+bool getIncludeDirectives(ArrayRef<const char> file, std::vector<IncludeDirective> &outDirectives) {
+    auto it = file.begin();
+    auto end = file.end();
+    auto skipBlanks = [&] {
+        while ((it != end) && ((*it == ' ') || (*it == '\t'))) {
+            ++it;
+        }
+    };
+    while (it != end) {
+        skipBlanks();
+        if ((it != end) && (*it == '#')) {
+            ++it;
+            skipBlanks();
+            constexpr ConstStringRef includeKeyword = "include";
+            if ((static_cast<size_t>(end - it) >= includeKeyword.size()) && (ConstStringRef(it, includeKeyword.size()) == includeKeyword)) {
+                it += includeKeyword.size();
+                skipBlanks();
+                if ((it == end) || ((*it != '"') && (*it != '<'))) {
+                    // computed includes can't be resolved without preprocessing
+                    return false;
+                }
+                char closing = (*it == '"') ? '"' : '>';
+                IncludeDirective directive;
+                directive.quoted = (closing == '"');
+                ++it;
+                while ((it != end) && (*it != closing) && (*it != '\n')) {
+                    directive.name += *it;
+                    ++it;
+                }
+                if ((it == end) || (*it != closing) || directive.name.empty()) {
+                    return false;
+                }
+                outDirectives.push_back(std::move(directive));
+            }
+        }
+        while ((it != end) && (*it != '\n')) {
+            ++it;
+        }
+        if (it != end) {
+            ++it;
+        }
+    }
+    return true;
+}
+
+bool resolveInclude(const IncludeDirective &directive, const std::string &currentDir, const std::vector<std::string> &includeDirs, std::string &outPath) {
+    if (isAbsolutePath(directive.name)) {
+        outPath = directive.name;
+        return fileExists(outPath);
+    }
+
+    std::vector<std::string> candidates;
+    if (directive.quoted) {
+        candidates.push_back(currentDir + directive.name);
+    }
+    for (const auto &includeDir : includeDirs) {
+        candidates.push_back(includeDir.empty() ? directive.name : includeDir + PATH_SEPARATOR + directive.name);
+    }
+
+    std::vector<std::string> matches;
+    for (const auto &candidate : candidates) {
+        if (fileExists(candidate) && (matches.end() == std::find(matches.begin(), matches.end(), candidate))) {
+            matches.push_back(candidate);
+        }
+    }
+    if (matches.empty()) {
+        return false;
+    }
+
+    // search order of the frontend may differ from ours, so different files under the same name can't be cached
+    size_t firstMatchSize = 0U;
+    auto firstMatchData = loadDataFromFile(matches[0].c_str(), firstMatchSize);
+    auto firstMatchHash = Hash::hash(firstMatchData.get(), firstMatchSize);
+    for (size_t i = 1; i < matches.size(); ++i) {
+        size_t matchSize = 0U;
+        auto matchData = loadDataFromFile(matches[i].c_str(), matchSize);
+        if ((matchSize != firstMatchSize) || (Hash::hash(matchData.get(), matchSize) != firstMatchHash)) {
+            return false;
+        }
+    }
+    outPath = matches[0];
+    return true;
+}
+
+bool collectIncludeDependencies(ArrayRef<const char> file, const std::string &fileDir, const std::vector<std::string> &includeDirs,
+                                std::set<std::string> &visited, IncludeDependencies &outIncludes);
+
+bool collectIncludeDependencies(const std::vector<IncludeDirective> &directives, const std::string &fileDir, const std::vector<std::string> &includeDirs,
+                                std::set<std::string> &visited, IncludeDependencies &outIncludes) {
+    for (const auto &directive : directives) {
+        std::string resolvedPath;
+        if (false == resolveInclude(directive, fileDir, includeDirs, resolvedPath)) {
+            return false;
+        }
+        if (false == visited.insert(resolvedPath).second) {
+            continue;
+        }
+        if (outIncludes.size() >= maxIncludeDependencies) {
+            return false;
+        }
+        size_t fileSize = 0U;
+        auto fileData = loadDataFromFile(resolvedPath.c_str(), fileSize);
+        outIncludes.push_back({resolvedPath, Hash::hash(fileData.get(), fileSize)});
+        if (false == collectIncludeDependencies(ArrayRef<const char>(fileData.get(), fileSize), getDirectory(resolvedPath), includeDirs, visited, outIncludes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool collectIncludeDependencies(ArrayRef<const char> file, const std::string &fileDir, const std::vector<std::string> &includeDirs,
+                                std::set<std::string> &visited, IncludeDependencies &outIncludes) {
+    std::vector<IncludeDirective> directives;
+    if (false == getIncludeDirectives(file, directives)) {
+        return false;
+    }
+    return collectIncludeDependencies(directives, fileDir, includeDirs, visited, outIncludes);
+}
+} // namespace
+
 std::mutex CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const specConstValuesMap &specConstants) {
     Hash hash;
 
     hash.update("----", 4);
@@ -35,6 +237,17 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update("----", 4);
     hash.update(&*internalOptions.begin(), internalOptions.size());
 
+    if (false == specConstants.empty()) {
+        // map iteration order is unspecified, so values are hashed in ids order
+        std::vector<std::pair<uint32_t, uint64_t>> sortedSpecConstants(specConstants.begin(), specConstants.end());
+        std::sort(sortedSpecConstants.begin(), sortedSpecConstants.end());
+        hash.update("----", 4);
+        for (const auto &specConst : sortedSpecConstants) {
+            hash.update(reinterpret_cast<const char *>(&specConst.first), sizeof(specConst.first));
+            hash.update(reinterpret_cast<const char *>(&specConst.second), sizeof(specConst.second));
+        }
+    }
+
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
     hash.update("----", 4);
@@ -42,14 +255,57 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
 
-    auto res = hash.finish();
-    std::stringstream stream;
-    stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
-           << std::hex
-           << res;
+    return toHashString(hash.finish());
+}
 
-    return stream.str();
+const std::string CompilerCache::getCachedFileName(const std::string &baseFileHash, const IncludeDependencies &includes) {
+    Hash hash;
+
+    hash.update(baseFileHash.c_str(), baseFileHash.size());
+    for (const auto &include : includes) {
+        hash.update("----", 4);
+        hash.update(include.path.c_str(), include.path.size());
+        hash.update(reinterpret_cast<const char *>(&include.contentHash), sizeof(include.contentHash));
+    }
+
+    return toHashString(hash.finish());
+}
+
+const std::string CompilerCache::getIncludeManifestName(const std::string &baseFileHash) {
+    return baseFileHash + "_includes";
+}
+
+bool CompilerCache::resolveIncludeDependencies(ArrayRef<const char> input, ArrayRef<const char> options, IncludeDependencies &outIncludes) {
+    outIncludes.clear();
+    auto optionTokens = tokenizeOptions(options);
+    auto includeDirs = getIncludeDirs(optionTokens);
+    std::set<std::string> visited;
+    // headers forced with -include are processed before the source, as done by the frontend
+    return collectIncludeDependencies(getForcedIncludes(optionTokens), "", includeDirs, visited, outIncludes) &&
+           collectIncludeDependencies(input, "", includeDirs, visited, outIncludes);
+}
+
+std::string CompilerCache::serializeIncludeManifest(const IncludeDependencies &includes) {
+    std::string manifest = includeManifestHeader;
+    for (const auto &include : includes) {
+        manifest += toHashString(include.contentHash) + " " + include.path + "\n";
+    }
+    return manifest;
+}
+
+bool CompilerCache::validateIncludeManifest(ArrayRef<const char> manifest, ArrayRef<const char> input, ArrayRef<const char> options, IncludeDependencies &outIncludes) {
+    outIncludes.clear();
+    // includes are re-resolved through the search order, so a header added in front of a recorded one invalidates the manifest
+    IncludeDependencies resolvedIncludes;
+    if (false == resolveIncludeDependencies(input, options, resolvedIncludes)) {
+        return false;
+    }
+    auto resolvedManifest = serializeIncludeManifest(resolvedIncludes);
+    if ((resolvedManifest.size() != manifest.size()) || (0 != memcmp(resolvedManifest.c_str(), manifest.begin(), manifest.size()))) {
+        return false;
+    }
+    outIncludes = std::move(resolvedIncludes);
+    return true;
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
@@ -14,10 +14,20 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
 
+using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
+
+struct IncludeDependency {
+    std::string path;
+    uint64_t contentHash = 0U;
+};
+using IncludeDependencies = std::vector<IncludeDependency>;
+
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
@@ -27,7 +37,14 @@ struct CompilerCacheConfig {
 class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
-                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               const specConstValuesMap &specConstants = {});
+    static const std::string getCachedFileName(const std::string &baseFileHash, const IncludeDependencies &includes);
+    static const std::string getIncludeManifestName(const std::string &baseFileHash);
+
+    static bool resolveIncludeDependencies(ArrayRef<const char> input, ArrayRef<const char> options, IncludeDependencies &outIncludes);
+    static std::string serializeIncludeManifest(const IncludeDependencies &includes);
+    static bool validateIncludeManifest(ArrayRef<const char> manifest, ArrayRef<const char> input, ArrayRef<const char> options, IncludeDependencies &outIncludes);
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
@@ -30,7 +30,8 @@ SpinLock CompilerInterface::spinlock;
 enum CachingMode {
     None,
     Direct,
-    PreProcess
+    PreProcess,
+    IncludeManifest
 };
 
 CompilerInterface::CompilerInterface()
@@ -68,13 +69,46 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          input.specializedValues);
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
 
+    // headers resolved by a previous build are rehashed instead of running the frontend
+    std::string includeManifestName;
+    std::string includeManifest;
+    if ((cachingMode == CachingMode::PreProcess) && (srcCodeType == IGC::CodeType::oclC) && (DebugManager.flags.EnableCompilerCacheIncludeManifest.get() != 0)) {
+        auto baseFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
+                                                             input.src,
+                                                             input.apiOptions,
+                                                             input.internalOptions,
+                                                             input.specializedValues);
+        includeManifestName = CompilerCache::getIncludeManifestName(baseFileHash);
+
+        std::string options = std::string(input.apiOptions.begin(), input.apiOptions.end()) + " " + std::string(input.internalOptions.begin(), input.internalOptions.end());
+        auto optionsRef = ArrayRef<const char>(options.c_str(), options.size());
+        IncludeDependencies includes;
+        size_t cachedManifestSize = 0U;
+        auto cachedManifest = cache->loadCachedBinary(includeManifestName, cachedManifestSize);
+        if (cachedManifest && CompilerCache::validateIncludeManifest(ArrayRef<const char>(cachedManifest.get(), cachedManifestSize), input.src, optionsRef, includes)) {
+            cachingMode = CachingMode::IncludeManifest;
+            kernelFileHash = CompilerCache::getCachedFileName(baseFileHash, includes);
+            output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+            if (output.deviceBinary.mem) {
+                return TranslationOutput::ErrorCode::Success;
+            }
+        } else {
+            if (CompilerCache::resolveIncludeDependencies(input.src, optionsRef, includes)) {
+                cachingMode = CachingMode::IncludeManifest;
+                kernelFileHash = CompilerCache::getCachedFileName(baseFileHash, includes);
+                includeManifest = CompilerCache::serializeIncludeManifest(includes);
+            }
+        }
+    }
+
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto fclOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -121,7 +155,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
+                                                          input.internalOptions,
+                                                          input.specializedValues);
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
@@ -145,6 +180,9 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     if (input.allowCaching) {
         cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+        if (false == includeManifest.empty()) {
+            cache->cacheBinary(includeManifestName, includeManifest.c_str(), static_cast<uint32_t>(includeManifest.size()));
+        }
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -362,6 +400,14 @@ bool CompilerInterface::initialize(std::unique_ptr<CompilerCache> cache, bool re
     return this->cache && igcAvailable && (fclAvailable || (false == requireFcl));
 }
 
+BuildWorkerPool *CompilerInterface::getBuildWorkerPool() {
+    auto ulock = this->lock();
+    if (nullptr == buildWorkerPool) {
+        buildWorkerPool = std::make_unique<BuildWorkerPool>(BuildWorkerPool::getDefaultWorkersCount());
+    }
+    return buildWorkerPool.get();
+}
+
 IGC::FclOclDeviceCtxTagOCL *CompilerInterface::getFclDeviceCtx(const Device &device) {
     auto ulock = this->lock();
     auto it = fclDeviceContexts.find(&device);
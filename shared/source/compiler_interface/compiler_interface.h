@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/compiler_interface/build_worker_pool.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
@@ -24,8 +25,6 @@
 namespace NEO {
 class Device;
 
-using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
-
 struct TranslationInput {
     TranslationInput(IGC::CodeType::CodeType_t srcType, IGC::CodeType::CodeType_t outType, IGC::CodeType::CodeType_t preferredIntermediateType = IGC::CodeType::undefined)
         : srcType(srcType), preferredIntermediateType(preferredIntermediateType), outType(outType) {
@@ -136,6 +135,12 @@ class CompilerInterface {
     MOCKABLE_VIRTUAL TranslationOutput::ErrorCode getSipKernelBinary(NEO::Device &device, SipKernelType type, bool bindlessSip, std::vector<char> &retBinary,
                                                                      std::vector<char> &stateSaveAreaHeader);
 
+    CompilerCache *getCache() const {
+        return cache.get();
+    }
+
+    BuildWorkerPool *getBuildWorkerPool();
+
   protected:
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
@@ -159,6 +164,9 @@ class CompilerInterface {
     std::map<const Device *, fclDevCtxUptr> fclDeviceContexts;
     CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> fclBaseTranslationCtx = nullptr;
 
+    // declared last so that pending builds finish before compilers are unloaded
+    std::unique_ptr<BuildWorkerPool> buildWorkerPool;
+
     MOCKABLE_VIRTUAL IGC::FclOclDeviceCtxTagOCL *getFclDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::IgcOclDeviceCtxTagOCL *getIgcDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::CodeType::CodeType_t getPreferredIntermediateRepresentation(const Device &device);
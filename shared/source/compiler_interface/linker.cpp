@@ -165,6 +165,54 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
 }
 
 void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId) {
+    struct SectionInfo {
+        std::string name;
+        SegmentType segment = SegmentType::Unknown;
+        int64_t kernelSegmentId = -1;
+        bool isKernelText = false;
+        bool isData = false;
+    };
+
+    // relocations and symbols are bucketed by section, so section names are resolved once per section
+    std::unordered_map<uint32_t, SectionInfo> sectionsInfo;
+    auto getSectionInfo = [&](int sectionIndex) -> const SectionInfo & {
+        auto sectionIt = sectionsInfo.find(static_cast<uint32_t>(sectionIndex));
+        if (sectionIt != sectionsInfo.end()) {
+            return sectionIt->second;
+        }
+        SectionInfo sectionInfo;
+        sectionInfo.name = elf.getSectionName(static_cast<uint32_t>(sectionIndex));
+        ConstStringRef nameRef(sectionInfo.name);
+        sectionInfo.segment = getSegmentForSection(nameRef);
+        sectionInfo.isKernelText = nameRef.startsWith(NEO::Elf::SectionsNamesZebin::textPrefix.data());
+        sectionInfo.isData = nameRef.startsWith(NEO::Elf::SpecialSectionNames::data.data());
+        if (sectionInfo.name.size() >= NEO::Elf::SectionsNamesZebin::textPrefix.length()) {
+            auto segmentIdIter = nameToSegmentId.find(sectionInfo.name.substr(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+            if (segmentIdIter != nameToSegmentId.end()) {
+                sectionInfo.kernelSegmentId = segmentIdIter->second;
+            }
+        }
+        return sectionsInfo.emplace(static_cast<uint32_t>(sectionIndex), std::move(sectionInfo)).first->second;
+    };
+
+    std::vector<size_t> relocationsCountPerSegment;
+    for (auto &reloc : elf.getRelocations()) {
+        auto &targetSection = getSectionInfo(reloc.targetSectionIndex);
+        if (targetSection.isKernelText && (targetSection.kernelSegmentId >= 0)) {
+            auto segmentId = static_cast<size_t>(targetSection.kernelSegmentId);
+            if (segmentId >= relocationsCountPerSegment.size()) {
+                relocationsCountPerSegment.resize(segmentId + 1, 0U);
+            }
+            ++relocationsCountPerSegment[segmentId];
+        }
+    }
+    if (relocationsCountPerSegment.size() > relocations.size()) {
+        relocations.resize(relocationsCountPerSegment.size());
+    }
+    for (size_t segmentId = 0; segmentId < relocationsCountPerSegment.size(); ++segmentId) {
+        relocations[segmentId].reserve(relocations[segmentId].size() + relocationsCountPerSegment[segmentId]);
+    }
+
     for (auto &reloc : elf.getRelocations()) {
         NEO::LinkerInput::RelocationInfo relocationInfo;
         relocationInfo.offset = reloc.offset;
@@ -183,19 +231,15 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64>
                                       : NEO::LinkerInput::RelocationInfo::Type::Unknown;
             break;
         }
-        auto name = elf.getSectionName(reloc.targetSectionIndex);
-        ConstStringRef nameRef(name);
+        auto &targetSection = getSectionInfo(reloc.targetSectionIndex);
 
-        if (nameRef.startsWith(NEO::Elf::SectionsNamesZebin::textPrefix.data())) {
-            auto kernelName = name.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-            auto segmentIdIter = nameToSegmentId.find(kernelName);
-            if (segmentIdIter != nameToSegmentId.end()) {
-                this->addElfTextSegmentRelocation(relocationInfo, segmentIdIter->second);
+        if (targetSection.isKernelText) {
+            if (targetSection.kernelSegmentId >= 0) {
+                this->addElfTextSegmentRelocation(std::move(relocationInfo), static_cast<uint32_t>(targetSection.kernelSegmentId));
             }
-        } else if (nameRef.startsWith(NEO::Elf::SpecialSectionNames::data.data())) {
-            auto symbolSectionName = elf.getSectionName(reloc.symbolSectionIndex);
-            auto symbolSegment = getSegmentForSection(symbolSectionName);
-            auto relocationSegment = getSegmentForSection(nameRef);
+        } else if (targetSection.isData) {
+            auto symbolSegment = getSectionInfo(reloc.symbolSectionIndex).segment;
+            auto relocationSegment = targetSection.segment;
             if (symbolSegment != NEO::SegmentType::Unknown &&
                 (relocationSegment == NEO::SegmentType::GlobalConstants || relocationSegment == NEO::SegmentType::GlobalVariables)) {
                 relocationInfo.relocationSegment = relocationSegment;
@@ -215,8 +259,8 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64>
             symbolInfo.size = static_cast<uint32_t>(symbol.size);
             auto type = elf.extractSymbolType(symbol);
 
-            auto symbolSectionName = elf.getSectionName(symbol.shndx);
-            auto symbolSegment = getSegmentForSection(symbolSectionName);
+            auto &symbolSection = getSectionInfo(symbol.shndx);
+            auto symbolSegment = symbolSection.segment;
 
             switch (type) {
             default:
@@ -228,12 +272,10 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<Elf::EI_CLASS_64>
                 traits.exportsGlobalConstants = symbolSegment == SegmentType::GlobalConstants;
                 break;
             case Elf::SYMBOL_TABLE_TYPE::STT_FUNC: {
-                auto kernelName = symbolSectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-                auto segmentIdIter = nameToSegmentId.find(kernelName);
-                if (segmentIdIter != nameToSegmentId.end()) {
+                if (symbolSection.kernelSegmentId >= 0) {
                     symbolInfo.segment = SegmentType::Instructions;
                     traits.exportsFunctions = true;
-                    int32_t instructionsSegmentId = static_cast<int32_t>(segmentIdIter->second);
+                    int32_t instructionsSegmentId = static_cast<int32_t>(symbolSection.kernelSegmentId);
                     UNRECOVERABLE_IF((this->exportedFunctionsSegmentId != -1) && (this->exportedFunctionsSegmentId != instructionsSegmentId));
                     this->exportedFunctionsSegmentId = instructionsSegmentId;
                 }
@@ -295,6 +337,8 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
         return;
     }
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
+    // relocations against the same symbol tend to be adjacent (e.g. low/high address parts), reuse last lookup
+    auto lastSymbolIt = relocatedSymbols.end();
     auto segIt = instructionsSegments.begin();
     for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
          relocsIt != relocsEnd; ++relocsIt, ++segIt) {
@@ -306,7 +350,10 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
             }
             UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
             auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+            if ((lastSymbolIt == relocatedSymbols.end()) || (lastSymbolIt->first != relocation.symbolName)) {
+                lastSymbolIt = relocatedSymbols.find(relocation.symbolName);
+            }
+            auto symbolIt = lastSymbolIt;
 
             bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
             bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
@@ -327,8 +374,12 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
                                GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
                                std::vector<UnresolvedExternal> &outUnresolvedExternals, Device *pDevice,
                                const void *constantsInitData, const void *variablesInitData) {
+    auto lastSymbolIt = relocatedSymbols.end();
     for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+        if ((lastSymbolIt == relocatedSymbols.end()) || (lastSymbolIt->first != relocation.symbolName)) {
+            lastSymbolIt = relocatedSymbols.find(relocation.symbolName);
+        }
+        auto symbolIt = lastSymbolIt;
         if (symbolIt == relocatedSymbols.end()) {
             outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
             continue;
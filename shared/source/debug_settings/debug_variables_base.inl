@@ -58,6 +58,11 @@ DECLARE_DEBUG_VARIABLE(bool, ForceImplicitFlush, false, "Flush after each enqueu
 DECLARE_DEBUG_VARIABLE(bool, ForcePipeControlPriorToWalker, false, "Allows to force pipe contron prior to walker.")
 DECLARE_DEBUG_VARIABLE(bool, ZebinAppendElws, false, "Append crossthread data with enqueue local work size")
 DECLARE_DEBUG_VARIABLE(bool, ZebinIgnoreIcbeVersion, false, "Ignore IGC\'s ICBE version")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelDescriptorsCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Stores kernel descriptors decoded from zebin next to compiler cache entries")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCompilerCacheIncludeManifest, -1, "-1: default (enabled), 0: disabled, 1: enabled. Validates cached binaries of OpenCL C sources with includes by hashing recorded headers instead of running the frontend")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncProgramBuild, -1, "-1: default (disabled), 0: disabled, 1: enabled. clBuildProgram with notify callback returns immediately and builds on compiler worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncBuildWorkerThreads, -1, "-1: default (up to 4 threads), >0: maximal number of compiler worker threads used for asynchronous builds")
+DECLARE_DEBUG_VARIABLE(int32_t, ZebinDecodeWorkerThreads, -1, "-1: default (decode in parallel only zebins with many kernels, using a bounded number of threads shared by the process), 0, 1: decode kernels sequentially, >1: number of threads used to decode kernels")
 DECLARE_DEBUG_VARIABLE(bool, UseExternalAllocatorForSshAndDsh, false, "Use 32 bit external Allocator for ssh and dsh in Level Zero")
 DECLARE_DEBUG_VARIABLE(bool, UseBindlessDebugSip, false, "Use bindless debug system routine")
 DECLARE_DEBUG_VARIABLE(bool, CleanStateInPreamble, false, "Ensures clean state in preamble.")
@@ -217,6 +222,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBuffers, -1, "-1: default, 0: unlimited, >0: in BatchedDispatchWithCounter mode flush after given number of command buffers is batched")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxCommandBufferSize, -1, "-1: default, 0: unlimited, >0: in BatchedDispatchWithCounter mode flush after given number of bytes is batched")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxLatency, -1, "-1: default, 0: unlimited, >0: in BatchedDispatchWithCounter mode flush when oldest batched command buffer is older than given number of microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideKernelSizeLimitForSmallDispatch, -1, "-1: default, >=0: on XEHP+ changes the threshold for treating kernel as small during NULL LWS selection")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
@@ -237,9 +245,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideComputeSupport, -1, "Ove
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableCacheFlush, -1, "-1: driver default, 0: additional cache flush is present 1: disable dispatching cache flush commands")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionNewResourceTlbFlush, -1, "-1: driver default - flush when new resource is bound, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableMonitorFence, -1, "Disable dispatching monitor fence commands")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default (8), >=2: maximum number of ring buffers direct submission can allocate before waiting for ring completion")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRingBufferGrowthThreshold, -1, "-1: default (1000 us), 0: disable ring buffer size growth, >0: time in us - ring buffer filled faster than threshold doubles size of next allocated ring buffer")
+DECLARE_DEBUG_VARIABLE(bool, PrintDirectSubmissionRingStatistics, false, "Print direct submission ring switch, stall and allocation statistics at direct submission destruction")
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, true, "Evict USM allocation after implicit migration to GPU")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmissionController, -1, "Enable direct submission terminating after given timeout, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeout, -1, "Set direct submission controller timeout, -1: default 5 ms, >=0: timeout in ms")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerMinTimeout, -1, "Set direct submission controller minimal adaptive timeout and check period, -1: default 1 ms, >=0: timeout in ms")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptiveTimeout, -1, "Adapt direct submission controller timeout per csr to observed submission inter-arrival time, -1: default (enabled), 0: disabled, 1: enabled")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -249,6 +262,7 @@ DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables different algorithm to compute local work size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Reuses local work size computed by driver for repeated enqueues of the same kernel and global work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableMultiRootDeviceContexts, true, "Enables support for multi root device contexts")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
 DECLARE_DEBUG_VARIABLE(bool, EnableExtendedVaFormats, false, "Enable more formats in cl-va sharing")
@@ -332,6 +346,13 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableStaticPartitioning, -1, "Divide workload i
 DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update task count after each enqueue, but send update request while wait, -1: default(disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
 DECLARE_DEBUG_VARIABLE(int32_t, UsmInitialPlacement, -1, "-1: default, 0: optimize for first CPU access, 1: optimize for first GPU access")
+DECLARE_DEBUG_VARIABLE(int64_t, UsmPageFaultMigrationChunkSize, -1, "-1: default (migrate whole shared allocation), >0: migrate shared allocations on CPU page fault in chunks of given size in bytes, aligned to page size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedUsmMigration, -1, "-1: default (enabled), 0: disabled, 1: enabled. Wait once for all shared allocations migrated to GPU before kernel submission and protect adjacent ranges together")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMigrationPredictionThreshold, -1, "-1: default (disabled), >0: on CPU page fault also migrate to CPU shared allocations which were accessed by CPU after given number of consecutive GPU phases")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrCacheSize, -1, "-1: default (disabled), >0: number of released userptr registrations of non-SVM host pointers kept for reuse by later allocations of the same host memory")
+DECLARE_DEBUG_VARIABLE(int64_t, ReusableAllocationsCacheSizeLimit, -1, "-1: default (no limit), >=0: total size in bytes of allocations kept for reuse by command stream receiver, completed allocations are released from the oldest when it is exceeded")
+DECLARE_DEBUG_VARIABLE(int32_t, GpuVaMagazineSize, -1, "-1: default (disabled), >0: number of GPU virtual address ranges of each size cached per thread group on standard heaps, ranges are taken from the heap in batches of half of this number")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterWorkersCount, -1, "-1: default (single worker thread), >1: number of threads releasing deferred deletions")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceHostPointerImport, -1, "-1: default, 0: disable, 1: enable, Forces the driver to import every host pointer coming into driver, WARNING this is not spec complaint.")
 DECLARE_DEBUG_VARIABLE(bool, UseMaxSimdSizeToDeduceMaxWorkgroupSize, false, "With this flag on, max workgroup size is deduced using SIMD32 instead of SIMD8, this causes the max wkg size to be 4 times bigger")
 DECLARE_DEBUG_VARIABLE(bool, ReturnRawGpuTimestamps, false, "Driver returns raw GPU tiemstamps instead of calculated ones.")
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,15 @@
 namespace NEO {
 namespace Ar {
 
+void ArEncoder::appendChunk(const ArrayRef<const uint8_t> data, size_t paddingSize, uint8_t paddingValue) {
+    Chunk chunk;
+    chunk.data = data;
+    chunk.paddingSize = paddingSize;
+    chunk.paddingValue = paddingValue;
+    chunks.push_back(chunk);
+    fileEntriesSize += data.size() + paddingSize;
+}
+
 ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData) {
     if (fileName.size() > sizeof(ArFileEntryHeader::identifier) - 1) {
         return nullptr; // encoding long identifiers is not supported
@@ -26,18 +35,17 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     auto alignedFileSize = fileData.size() + (fileData.size() & 1U);
     ArFileEntryHeader header = {};
 
-    if (padTo8Bytes && (0 != ((fileEntries.size() + sizeof(ArFileEntryHeader)) % 8))) {
+    if (padTo8Bytes && (0 != ((fileEntriesSize + sizeof(ArFileEntryHeader)) % 8))) {
         ArFileEntryHeader paddingHeader = {};
         auto paddingName = "pad_" + std::to_string(paddingEntry++);
         UNRECOVERABLE_IF(paddingName.length() > sizeof(paddingHeader.identifier));
         memcpy_s(paddingHeader.identifier, sizeof(paddingHeader.identifier), paddingName.c_str(), paddingName.size());
         paddingHeader.identifier[paddingName.size()] = SpecialFileNames::fileNameTerminator;
-        size_t paddingSize = 8U - ((fileEntries.size() + 2 * sizeof(ArFileEntryHeader)) % 8);
+        size_t paddingSize = 8U - ((fileEntriesSize + 2 * sizeof(ArFileEntryHeader)) % 8);
         auto padSizeString = std::to_string(paddingSize);
         memcpy_s(paddingHeader.fileSizeInBytes, sizeof(paddingHeader.fileSizeInBytes), padSizeString.c_str(), padSizeString.size());
-        this->fileEntries.reserve(this->fileEntries.size() + sizeof(paddingHeader) + paddingSize + sizeof(header) + alignedFileSize);
-        this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&paddingHeader), reinterpret_cast<uint8_t *>(&paddingHeader + 1));
-        this->fileEntries.resize(this->fileEntries.size() + paddingSize, ' ');
+        headers.push_back(paddingHeader);
+        appendChunk(ArrayRef<const uint8_t>::fromAny(&*headers.rbegin(), 1U), paddingSize, ' ');
     }
 
     memcpy_s(header.identifier, sizeof(header.identifier), fileName.begin(), fileName.size());
@@ -45,18 +53,41 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     auto sizeString = std::to_string(fileData.size());
     UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
     memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
-    this->fileEntries.reserve(this->fileEntries.size() + sizeof(header) + alignedFileSize);
-    auto newFileHeaderOffset = this->fileEntries.size();
-    this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
-    this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
-    this->fileEntries.resize(this->fileEntries.size() + alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
-    return reinterpret_cast<ArFileEntryHeader *>(this->fileEntries.data() + newFileHeaderOffset);
+    headers.push_back(header);
+    appendChunk(ArrayRef<const uint8_t>::fromAny(&*headers.rbegin(), 1U), 0U, 0U);
+
+    ArrayRef<const uint8_t> storedFileData = fileData;
+    if ((false == referenceExternalData) && (false == fileData.empty())) {
+        ownedData.emplace_back(fileData.begin(), fileData.end());
+        storedFileData = ArrayRef<const uint8_t>(*ownedData.rbegin());
+    }
+    appendChunk(storedFileData, alignedFileSize - fileData.size(), 0U); // implicit 2-byte alignment
+    return &*headers.rbegin();
+}
+
+size_t ArEncoder::encode(ArrayRef<uint8_t> out) const {
+    auto encodedSize = getEncodedSize();
+    if (out.size() < encodedSize) {
+        return encodedSize;
+    }
+
+    auto dst = out.begin();
+    memcpy_s(dst, encodedSize, arMagic.begin(), arMagic.size());
+    auto pos = arMagic.size();
+    for (const auto &chunk : chunks) {
+        if (false == chunk.data.empty()) {
+            memcpy_s(dst + pos, encodedSize - pos, chunk.data.begin(), chunk.data.size());
+            pos += chunk.data.size();
+        }
+        memset(dst + pos, chunk.paddingValue, chunk.paddingSize);
+        pos += chunk.paddingSize;
+    }
+    return encodedSize;
 }
 
 std::vector<uint8_t> ArEncoder::encode() const {
-    std::vector<uint8_t> ret;
-    ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
-    ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
+    std::vector<uint8_t> ret(getEncodedSize());
+    encode(ArrayRef<uint8_t>(ret));
     return ret;
 }
 
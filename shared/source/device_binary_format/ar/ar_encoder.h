@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <cstring>
+#include <deque>
 #include <vector>
 
 namespace NEO {
@@ -20,11 +21,33 @@ namespace Ar {
 struct ArEncoder {
     ArEncoder(bool padTo8Bytes = false) : padTo8Bytes(padTo8Bytes) {}
     ArFileEntryHeader *appendFileEntry(const ConstStringRef fileName, const ArrayRef<const uint8_t> fileData);
+
+    size_t getEncodedSize() const {
+        return arMagic.size() + fileEntriesSize;
+    }
+    size_t encode(ArrayRef<uint8_t> out) const;
     std::vector<uint8_t> encode() const;
 
+    // when set, file data is not copied and must outlive the encoder
+    void setReferenceExternalData(bool referenceExternalData) {
+        this->referenceExternalData = referenceExternalData;
+    }
+
   protected:
-    std::vector<uint8_t> fileEntries;
+    struct Chunk {
+        ArrayRef<const uint8_t> data;
+        size_t paddingSize = 0U;
+        uint8_t paddingValue = 0U;
+    };
+
+    void appendChunk(const ArrayRef<const uint8_t> data, size_t paddingSize, uint8_t paddingValue);
+
+    std::deque<ArFileEntryHeader> headers;
+    std::deque<std::vector<uint8_t>> ownedData;
+    std::vector<Chunk> chunks;
+    size_t fileEntriesSize = 0U;
     bool padTo8Bytes = false;
+    bool referenceExternalData = false;
     uint32_t paddingEntry = 0U;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 #include "shared/source/device_binary_format/patchtokens_dumper.h"
 #include "shared/source/device_binary_format/patchtokens_validator.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/program/program_info.h"
 #include "shared/source/program/program_info_from_patchtokens.h"
 
+#include "opencl/source/program/kernel_info.h"
 #include "opencl/source/utilities/logger.h"
 
 namespace NEO {
@@ -45,18 +47,50 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens
 
 template <>
 DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
+    // single pass over the blob - each kernel is validated and populated right after it's decoded
     NEO::PatchTokenBinary::ProgramFromPatchtokens decodedProgram = {};
-    NEO::PatchTokenBinary::decodeProgramFromPatchtokensBlob(src.deviceBinary, decodedProgram);
+    NEO::PatchTokenBinary::decodeProgramScopeFromPatchtokensBlob(src.deviceBinary, decodedProgram);
+
+    auto validatorErr = PatchTokenBinary::validateProgramScope(decodedProgram, outErrReason, outWarning);
+    if (DecodeError::Success != validatorErr) {
+        DBG_LOG(LogPatchTokens, NEO::PatchTokenBinary::asString(decodedProgram).c_str());
+        return validatorErr;
+    }
+
+    auto kernelInfosCountBefore = dst.kernelInfos.size();
+    bool hadLinkerInput = (nullptr != dst.linkerInput);
+    auto numKernels = decodedProgram.header->NumberOfKernels;
+    decodedProgram.kernels.reserve(numKernels);
+    auto kernelsDataLeft = decodedProgram.blobs.kernelsInfo;
+    for (uint32_t kernelNum = 0; (kernelNum < numKernels) && (DecodeError::Success == validatorErr); ++kernelNum) {
+        decodedProgram.kernels.resize(kernelNum + 1);
+        auto &decodedKernel = decodedProgram.kernels[kernelNum];
+        if (false == NEO::PatchTokenBinary::decodeKernelFromPatchtokensBlob(kernelsDataLeft, decodedKernel)) {
+            decodedProgram.decodeStatus = DecodeError::InvalidBinary;
+            validatorErr = PatchTokenBinary::validateProgramScope(decodedProgram, outErrReason, outWarning);
+            break;
+        }
+        kernelsDataLeft = ArrayRef<const uint8_t>(kernelsDataLeft.begin() + decodedKernel.blobs.kernelInfo.size(), kernelsDataLeft.end());
+
+        validatorErr = PatchTokenBinary::validateKernel(decodedKernel, outErrReason, outWarning);
+        if (DecodeError::Success == validatorErr) {
+            NEO::populateSingleKernelInfo(dst, decodedProgram, kernelNum);
+        }
+    }
     DBG_LOG(LogPatchTokens, NEO::PatchTokenBinary::asString(decodedProgram).c_str());
 
-    std::string validatorWarnings;
-    std::string validatorErrMessage;
-    auto validatorErr = PatchTokenBinary::validate(decodedProgram, outErrReason, outWarning);
     if (DecodeError::Success != validatorErr) {
+        for (auto kernelInfoIt = dst.kernelInfos.begin() + kernelInfosCountBefore; kernelInfoIt != dst.kernelInfos.end(); ++kernelInfoIt) {
+            delete *kernelInfoIt;
+        }
+        dst.kernelInfos.resize(kernelInfosCountBefore);
+        if (false == hadLinkerInput) {
+            dst.linkerInput.reset();
+        }
         return validatorErr;
     }
 
-    NEO::populateProgramInfo(dst, decodedProgram);
+    NEO::populateProgramScopeInfo(dst, decodedProgram);
 
     return DecodeError::Success;
 }
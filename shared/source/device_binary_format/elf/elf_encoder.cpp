@@ -7,9 +7,11 @@
 
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 
+#include "shared/source/helpers/string.h"
 #include "shared/source/utilities/range.h"
 
 #include <algorithm>
+#include <cstring>
 
 namespace NEO {
 
@@ -30,17 +32,28 @@ ElfEncoder<NumBits>::ElfEncoder(bool addUndefSectionHeader, bool addHeaderSectio
     }
 }
 
+template <ELF_IDENTIFIER_CLASS NumBits>
+size_t ElfEncoder<NumBits>::appendData(const ArrayRef<const uint8_t> newData, size_t alignment) {
+    auto alignedOffset = alignUp(this->dataSize, alignment);
+    DataChunk chunk;
+    chunk.offset = alignedOffset;
+    if (referenceExternalData) {
+        chunk.data = newData;
+    } else {
+        ownedData.emplace_back(newData.begin(), newData.end());
+        chunk.data = ArrayRef<const uint8_t>(*ownedData.rbegin());
+    }
+    dataChunks.push_back(chunk);
+    this->dataSize = alignedOffset + alignUp(newData.size(), alignment);
+    return alignedOffset;
+}
+
 template <ELF_IDENTIFIER_CLASS NumBits>
 void ElfEncoder<NumBits>::appendSection(const ElfSectionHeader<NumBits> &sectionHeader, const ArrayRef<const uint8_t> sectionData) {
     sectionHeaders.push_back(sectionHeader);
     if ((SHT_NOBITS != sectionHeader.type) && (false == sectionData.empty())) {
         auto sectionDataAlignment = std::min<uint64_t>(defaultDataAlignment, 8U);
-        auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(sectionDataAlignment));
-        auto alignedSize = alignUp(sectionData.size(), static_cast<size_t>(sectionDataAlignment));
-        this->data.reserve(alignedOffset + alignedSize);
-        this->data.resize(alignedOffset, 0U);
-        this->data.insert(this->data.end(), sectionData.begin(), sectionData.end());
-        this->data.resize(alignedOffset + alignedSize, 0U);
+        auto alignedOffset = appendData(sectionData, static_cast<size_t>(sectionDataAlignment));
         sectionHeaders.rbegin()->offset = static_cast<decltype(sectionHeaders.rbegin()->offset)>(alignedOffset);
         sectionHeaders.rbegin()->size = static_cast<decltype(sectionHeaders.rbegin()->size)>(sectionData.size());
     }
@@ -52,12 +65,7 @@ void ElfEncoder<NumBits>::appendSegment(const ElfProgramHeader<NumBits> &program
     programHeaders.push_back(programHeader);
     if (false == segmentData.empty()) {
         UNRECOVERABLE_IF(programHeader.align == 0);
-        auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(programHeader.align));
-        auto alignedSize = alignUp(segmentData.size(), static_cast<size_t>(programHeader.align));
-        this->data.reserve(alignedOffset + alignedSize);
-        this->data.resize(alignedOffset, 0U);
-        this->data.insert(this->data.end(), segmentData.begin(), segmentData.end());
-        this->data.resize(alignedOffset + alignedSize, 0U);
+        auto alignedOffset = appendData(segmentData, static_cast<size_t>(programHeader.align));
         programHeaders.rbegin()->offset = static_cast<decltype(programHeaders.rbegin()->offset)>(alignedOffset);
         programHeaders.rbegin()->fileSz = static_cast<decltype(programHeaders.rbegin()->fileSz)>(segmentData.size());
     }
@@ -113,7 +121,12 @@ uint32_t ElfEncoder<NumBits>::appendSectionName(ConstStringRef str) {
 }
 
 template <ELF_IDENTIFIER_CLASS NumBits>
-std::vector<uint8_t> ElfEncoder<NumBits>::encode() const {
+size_t ElfEncoder<NumBits>::getEncodedSize() const {
+    return encode(ArrayRef<uint8_t>());
+}
+
+template <ELF_IDENTIFIER_CLASS NumBits>
+size_t ElfEncoder<NumBits>::encode(ArrayRef<uint8_t> out) const {
     ElfFileHeader<NumBits> elfFileHeader = this->elfFileHeader;
     StackVec<ElfProgramHeader<NumBits>, 32> programHeaders = this->programHeaders;
     StackVec<ElfSectionHeader<NumBits>, 32> sectionHeaders = this->sectionHeaders;
@@ -126,8 +139,8 @@ std::vector<uint8_t> ElfEncoder<NumBits>::encode() const {
     size_t alignedSectionNamesDataSize = 0U;
     size_t dataPaddingBeforeSectionNames = 0U;
     if ((false == sectionHeaders.empty()) && addHeaderSectionNamesSection) {
-        auto alignedDataSize = alignUp(data.size(), static_cast<size_t>(defaultDataAlignment));
-        dataPaddingBeforeSectionNames = alignedDataSize - data.size();
+        auto alignedDataSize = alignUp(dataSize, static_cast<size_t>(defaultDataAlignment));
+        dataPaddingBeforeSectionNames = alignedDataSize - dataSize;
         sectionHeaderNamesSection.type = SHT_STRTAB;
         sectionHeaderNamesSection.name = specialStringsOffsets.shStrTab;
         sectionHeaderNamesSection.offset = static_cast<decltype(sectionHeaderNamesSection.offset)>(alignedDataSize);
@@ -152,34 +165,56 @@ std::vector<uint8_t> ElfEncoder<NumBits>::encode() const {
     }
 
     auto dataOffset = alignUp(sectionHeadersOffset + elfFileHeader.shEntSize * elfFileHeader.shNum, static_cast<size_t>(maxDataAlignmentNeeded));
-    auto stringTabOffset = dataOffset + data.size();
+    auto stringTabOffset = dataOffset + dataSize + dataPaddingBeforeSectionNames;
+    auto encodedSize = stringTabOffset + alignedSectionNamesDataSize;
+    if (out.size() < encodedSize) {
+        return encodedSize;
+    }
 
-    std::vector<uint8_t> ret;
-    ret.reserve(stringTabOffset + alignedSectionNamesDataSize);
-    ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&elfFileHeader), reinterpret_cast<uint8_t *>(&elfFileHeader + 1));
-    ret.resize(programHeadersOffset, 0U);
+    auto dst = out.begin();
+    memset(dst, 0, dataOffset);
+    memcpy_s(dst, encodedSize, &elfFileHeader, sizeof(elfFileHeader));
 
+    auto programHeaderPos = programHeadersOffset;
     for (auto &programHeader : programHeaders) {
         if (0 != programHeader.fileSz) {
             programHeader.offset = static_cast<decltype(programHeader.offset)>(programHeader.offset + dataOffset);
         }
-        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&programHeader), reinterpret_cast<uint8_t *>(&programHeader + 1));
-        ret.resize(ret.size() + elfFileHeader.phEntSize - sizeof(programHeader), 0U);
+        memcpy_s(dst + programHeaderPos, encodedSize - programHeaderPos, &programHeader, sizeof(programHeader));
+        programHeaderPos += elfFileHeader.phEntSize;
     }
 
+    auto sectionHeaderPos = sectionHeadersOffset;
     for (auto &sectionHeader : sectionHeaders) {
         if ((SHT_NOBITS != sectionHeader.type) && (0 != sectionHeader.size)) {
             sectionHeader.offset = static_cast<decltype(sectionHeader.offset)>(sectionHeader.offset + dataOffset);
         }
-        ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&sectionHeader), reinterpret_cast<uint8_t *>(&sectionHeader + 1));
-        ret.resize(ret.size() + elfFileHeader.shEntSize - sizeof(sectionHeader), 0U);
+        memcpy_s(dst + sectionHeaderPos, encodedSize - sectionHeaderPos, &sectionHeader, sizeof(sectionHeader));
+        sectionHeaderPos += elfFileHeader.shEntSize;
+    }
+
+    // data is written in place, only alignment gaps are zeroed
+    auto pos = dataOffset;
+    for (const auto &chunk : dataChunks) {
+        auto chunkPos = dataOffset + chunk.offset;
+        memset(dst + pos, 0, chunkPos - pos);
+        memcpy_s(dst + chunkPos, encodedSize - chunkPos, chunk.data.begin(), chunk.data.size());
+        pos = chunkPos + chunk.data.size();
+    }
+    memset(dst + pos, 0, stringTabOffset - pos);
+
+    auto sectionNamesSize = static_cast<size_t>(sectionHeaderNamesSection.size);
+    if (sectionNamesSize > 0U) {
+        memcpy_s(dst + stringTabOffset, encodedSize - stringTabOffset, stringTable.data(), sectionNamesSize);
     }
+    memset(dst + stringTabOffset + sectionNamesSize, 0, alignedSectionNamesDataSize - sectionNamesSize);
+    return encodedSize;
+}
 
-    ret.resize(dataOffset, 0U);
-    ret.insert(ret.end(), data.begin(), data.end());
-    ret.resize(ret.size() + dataPaddingBeforeSectionNames, 0U);
-    ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(stringTable.data()), reinterpret_cast<const uint8_t *>(stringTable.data() + static_cast<size_t>(sectionHeaderNamesSection.size)));
-    ret.resize(ret.size() + alignedSectionNamesDataSize - static_cast<size_t>(sectionHeaderNamesSection.size), 0U);
+template <ELF_IDENTIFIER_CLASS NumBits>
+std::vector<uint8_t> ElfEncoder<NumBits>::encode() const {
+    std::vector<uint8_t> ret(getEncodedSize());
+    encode(ArrayRef<uint8_t>(ret));
     return ret;
 }
 
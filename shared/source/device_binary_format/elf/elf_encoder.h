@@ -14,6 +14,7 @@
 
 #include <queue>
 #include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -42,13 +43,27 @@ struct ElfEncoder {
 
     uint32_t appendSectionName(ConstStringRef str);
 
+    size_t getEncodedSize() const;
+    size_t encode(ArrayRef<uint8_t> out) const;
     std::vector<uint8_t> encode() const;
 
     ElfFileHeader<NumBits> &getElfFileHeader() {
         return elfFileHeader;
     }
 
+    // when set, appended data is not copied and must outlive the encoder
+    void setReferenceExternalData(bool referenceExternalData) {
+        this->referenceExternalData = referenceExternalData;
+    }
+
   protected:
+    struct DataChunk {
+        size_t offset = 0U;
+        ArrayRef<const uint8_t> data;
+    };
+
+    size_t appendData(const ArrayRef<const uint8_t> newData, size_t alignment);
+
     bool addUndefSectionHeader = false;
     bool addHeaderSectionNamesSection = false;
     uint64_t defaultDataAlignment = 8U;
@@ -56,7 +71,10 @@ struct ElfEncoder {
     ElfFileHeader<NumBits> elfFileHeader;
     StackVec<ElfProgramHeader<NumBits>, 32> programHeaders;
     StackVec<ElfSectionHeader<NumBits>, 32> sectionHeaders;
-    std::vector<uint8_t> data;
+    StackVec<DataChunk, 32> dataChunks;
+    std::vector<std::vector<uint8_t>> ownedData;
+    size_t dataSize = 0U;
+    bool referenceExternalData = false;
     std::vector<char> stringTable;
     struct {
         uint32_t shStrTab = 0;
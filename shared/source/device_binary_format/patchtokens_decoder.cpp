@@ -596,6 +596,15 @@ bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, Progr
     return decodeSuccess;
 }
 
+bool decodeProgramScopeFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out) {
+    out.blobs.programInfo = programBlob;
+    bool decodeSuccess = decodeProgramHeader(out);
+    decodeSuccess = decodeSuccess && decodePatchList(out.blobs.patchList, out);
+    out.decodeStatus = decodeSuccess ? DecodeError::Success : DecodeError::InvalidBinary;
+
+    return decodeSuccess;
+}
+
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob) {
     UNRECOVERABLE_IF(kernelBlob.size() <= sizeof(SKernelBinaryHeaderCommon));
     auto dataToHash = ArrayRef<const uint8_t>(ptrOffset(kernelBlob.begin(), sizeof(SKernelBinaryHeaderCommon)), kernelBlob.end());
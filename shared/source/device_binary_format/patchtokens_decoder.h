@@ -194,6 +194,8 @@ struct KernelArgAttributesFromPatchtokens {
 
 bool decodeKernelFromPatchtokensBlob(ArrayRef<const uint8_t> kernelBlob, KernelFromPatchtokens &out);
 bool decodeProgramFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out);
+// decodes only program header and program-scope patch list, kernels are left for the caller (see blobs.kernelsInfo)
+bool decodeProgramScopeFromPatchtokensBlob(ArrayRef<const uint8_t> programBlob, ProgramFromPatchtokens &out);
 uint32_t calcKernelChecksum(const ArrayRef<const uint8_t> kernelBlob);
 bool hasInvalidChecksum(const KernelFromPatchtokens &decodedKernel);
 
@@ -21,8 +21,8 @@ namespace PatchTokenBinary {
 
 bool allowUnhandledTokens = true;
 
-DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
-                     std::string &outErrReason, std::string &outWarnings) {
+DecodeError validateProgramScope(const ProgramFromPatchtokens &decodedProgram,
+                                 std::string &outErrReason, std::string &outWarnings) {
     if (decodedProgram.decodeStatus != DecodeError::Success) {
         outErrReason = "ProgramFromPatchtokens wasn't successfully decoded";
         return DecodeError::InvalidBinary;
@@ -84,61 +84,81 @@ DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
         return DecodeError::UnhandledBinary;
     }
 
-    for (const auto &decodedKernel : decodedProgram.kernels) {
-        if (decodedKernel.decodeStatus != DecodeError::Success) {
-            outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
+    return DecodeError::Success;
+}
+
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel,
+                           std::string &outErrReason, std::string &outWarnings) {
+    if (decodedKernel.decodeStatus != DecodeError::Success) {
+        outErrReason = "KernelFromPatchtokens wasn't successfully decoded";
+        return DecodeError::UnhandledBinary;
+    }
+
+    UNRECOVERABLE_IF(nullptr == decodedKernel.header);
+    if (hasInvalidChecksum(decodedKernel)) {
+        outErrReason = "KernelFromPatchtokens has invalid checksum";
+        return DecodeError::UnhandledBinary;
+    }
+
+    if (nullptr == decodedKernel.tokens.executionEnvironment) {
+        outErrReason = "Missing execution environment";
+        return DecodeError::UnhandledBinary;
+    } else {
+        switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
+        case 1:
+            break;
+        case 8:
+            break;
+        case 16:
+            break;
+        case 32:
+            break;
+        default:
+            outErrReason = "Invalid LargestCompiledSIMDSize";
             return DecodeError::UnhandledBinary;
         }
+    }
 
-        UNRECOVERABLE_IF(nullptr == decodedKernel.header);
-        if (hasInvalidChecksum(decodedKernel)) {
-            outErrReason = "KernelFromPatchtokens has invalid checksum";
+    for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
+        if (kernelArg.argInfo == nullptr) {
+            continue;
+        }
+        auto argInfoInlineData = getInlineData(kernelArg.argInfo);
+        auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
+        if (KernelArgMetadata::AccessUnknown == accessQualifier) {
+            outErrReason = "Unhandled access qualifier";
             return DecodeError::UnhandledBinary;
         }
-
-        if (nullptr == decodedKernel.tokens.executionEnvironment) {
-            outErrReason = "Missing execution environment";
+        auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
+        if (KernelArgMetadata::AddrUnknown == addressQualifier) {
+            outErrReason = "Unhandled address qualifier";
             return DecodeError::UnhandledBinary;
-        } else {
-            switch (decodedKernel.tokens.executionEnvironment->LargestCompiledSIMDSize) {
-            case 1:
-                break;
-            case 8:
-                break;
-            case 16:
-                break;
-            case 32:
-                break;
-            default:
-                outErrReason = "Invalid LargestCompiledSIMDSize";
-                return DecodeError::UnhandledBinary;
-            }
         }
+    }
 
-        for (auto &kernelArg : decodedKernel.tokens.kernelArgs) {
-            if (kernelArg.argInfo == nullptr) {
-                continue;
-            }
-            auto argInfoInlineData = getInlineData(kernelArg.argInfo);
-            auto accessQualifier = KernelArgMetadata::parseAccessQualifier(parseLimitedString(argInfoInlineData.accessQualifier.begin(), argInfoInlineData.accessQualifier.size()));
-            if (KernelArgMetadata::AccessUnknown == accessQualifier) {
-                outErrReason = "Unhandled access qualifier";
-                return DecodeError::UnhandledBinary;
-            }
-            auto addressQualifier = KernelArgMetadata::parseAddressSpace(parseLimitedString(argInfoInlineData.addressQualifier.begin(), argInfoInlineData.addressQualifier.size()));
-            if (KernelArgMetadata::AddrUnknown == addressQualifier) {
-                outErrReason = "Unhandled address qualifier";
-                return DecodeError::UnhandledBinary;
-            }
+    for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
+        if (allowUnhandledTokens) {
+            outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+        } else {
+            outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
+            return DecodeError::UnhandledBinary;
         }
+    }
 
-        for (const auto &unhandledToken : decodedKernel.unhandledTokens) {
-            if (allowUnhandledTokens) {
-                outWarnings = "Unknown kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-            } else {
-                outErrReason = "Unhandled required kernel-scope Patch Token : " + std::to_string(unhandledToken->Token);
-                return DecodeError::UnhandledBinary;
-            }
+    return DecodeError::Success;
+}
+
+DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
+                     std::string &outErrReason, std::string &outWarnings) {
+    auto programScopeErr = validateProgramScope(decodedProgram, outErrReason, outWarnings);
+    if (DecodeError::Success != programScopeErr) {
+        return programScopeErr;
+    }
+
+    for (const auto &decodedKernel : decodedProgram.kernels) {
+        auto kernelErr = validateKernel(decodedKernel, outErrReason, outWarnings);
+        if (DecodeError::Success != kernelErr) {
+            return kernelErr;
         }
     }
 
@@ -17,10 +17,17 @@ namespace PatchTokenBinary {
 extern bool allowUnhandledTokens;
 
 struct ProgramFromPatchtokens;
+struct KernelFromPatchtokens;
 
 DecodeError validate(const ProgramFromPatchtokens &decodedProgram,
                      std::string &outErrReason, std::string &outWarnings);
 
+DecodeError validateProgramScope(const ProgramFromPatchtokens &decodedProgram,
+                                 std::string &outErrReason, std::string &outWarnings);
+
+DecodeError validateKernel(const KernelFromPatchtokens &decodedKernel,
+                           std::string &outErrReason, std::string &outWarnings);
+
 } // namespace PatchTokenBinary
 
 } // namespace NEO
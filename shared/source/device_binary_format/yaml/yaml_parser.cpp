@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <cstring>
+
 namespace NEO {
 
 namespace Yaml {
@@ -21,6 +23,46 @@ std::string constructYamlError(size_t lineNumber, const char *lineBeg, const cha
     return ret;
 }
 
+TokenizedSizeEstimates estimateTokenizedSize(ConstStringRef text) {
+    size_t numNewLines = 0U;
+    size_t numColons = 0U;
+    size_t numDashes = 0U;
+    size_t numHashes = 0U;
+
+    // branchless counting in fixed size blocks lets the compiler vectorize the inner loop
+    constexpr size_t blockSize = 32U;
+    auto it = text.begin();
+    auto blocksEnd = it + (text.size() / blockSize) * blockSize;
+    for (; it < blocksEnd; it += blockSize) {
+        uint32_t blockNewLines = 0U;
+        uint32_t blockColons = 0U;
+        uint32_t blockDashes = 0U;
+        uint32_t blockHashes = 0U;
+        for (size_t i = 0; i < blockSize; ++i) {
+            blockNewLines += ('\n' == it[i]);
+            blockColons += (':' == it[i]);
+            blockDashes += ('-' == it[i]);
+            blockHashes += ('#' == it[i]);
+        }
+        numNewLines += blockNewLines;
+        numColons += blockColons;
+        numDashes += blockDashes;
+        numHashes += blockHashes;
+    }
+    for (; it < text.end(); ++it) {
+        numNewLines += ('\n' == *it);
+        numColons += (':' == *it);
+        numDashes += ('-' == *it);
+        numHashes += ('#' == *it);
+    }
+
+    TokenizedSizeEstimates ret;
+    ret.numLines = numNewLines + 1;
+    // each line ends with newline token, dictionary entry is key, colon and value, comment is marker and text
+    ret.numTokens = ret.numLines + 3 * numColons + numDashes + 2 * numHashes;
+    return ret;
+}
+
 inline Node &addNode(NodesCache &outNodes, Node &parent) {
     UNRECOVERABLE_IF(outNodes.size() >= outNodes.capacity()); // resize must not grow
     parent.firstChildId = static_cast<NodeId>(outNodes.size());
@@ -114,6 +156,10 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         return true;
     }
 
+    auto estimates = estimateTokenizedSize(text);
+    outLines.reserve(outLines.size() + estimates.numLines);
+    outTokens.reserve(outTokens.size() + estimates.numTokens);
+
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
@@ -139,11 +185,9 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
             auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
+            if (commentIt < context.end) {
+                auto commentEnd = reinterpret_cast<const char *>(memchr(commentIt, '\n', context.end - commentIt));
+                commentIt = (nullptr != commentEnd) ? commentEnd : context.end;
             }
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
@@ -284,6 +328,13 @@ void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
+
+    // list entries with inline dictionary get additional node when finalized
+    size_t estimatedNumNodes = 1U;
+    for (const auto &line : lines) {
+        estimatedNumNodes += isUnused(line.lineType) ? 0U : ((Line::LineType::ListEntry == line.lineType) ? 2U : 1U);
+    }
+    outNodes.reserve(outNodes.size() + estimatedNumNodes);
     outNodes.resize(1);
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
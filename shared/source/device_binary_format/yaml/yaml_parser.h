@@ -251,6 +251,13 @@ inline bool reserveBasedOnEstimates(T &container, It beg, It end, It pos) {
 using TokensCache = StackVec<Token, 2048>;
 using LinesCache = StackVec<Line, 512>;
 
+struct TokenizedSizeEstimates {
+    size_t numLines = 0U;
+    size_t numTokens = 0U;
+};
+
+TokenizedSizeEstimates estimateTokenizedSize(ConstStringRef text);
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason = nullptr);
 
 bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens, std::string &outErrReason, std::string &outWarning);
@@ -20,6 +20,9 @@
 
 #include "opencl/source/program/kernel_info.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <tuple>
 
 namespace NEO {
@@ -1134,6 +1137,101 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<N
     return DecodeError::Success;
 }
 
+uint32_t getZebinDecodeWorkersCount(size_t kernelsCount) {
+    auto workersCount = 1U;
+    if (kernelsCount >= minKernelsCountForParallelZebinDecode) {
+        auto workersForKernels = static_cast<uint32_t>(kernelsCount / minKernelsCountPerZebinDecodeWorker);
+        workersCount = std::min({maxZebinDecodeWorkersCount, workersForKernels, std::max(1U, std::thread::hardware_concurrency())});
+    }
+    if (DebugManager.flags.ZebinDecodeWorkerThreads.get() != -1) {
+        workersCount = static_cast<uint32_t>(std::max(1, DebugManager.flags.ZebinDecodeWorkerThreads.get()));
+    }
+    return static_cast<uint32_t>(std::min<size_t>(workersCount, std::max<size_t>(1U, kernelsCount)));
+}
+
+// helper threads are shared by all decodes in the process, concurrent decodes don't multiply them
+static std::atomic<uint32_t> zebinDecodeHelperThreadsInUse{0U};
+
+uint32_t acquireZebinDecodeHelperThreads(uint32_t requested) {
+    constexpr uint32_t maxHelpers = maxZebinDecodeWorkersCount - 1;
+    auto inUse = zebinDecodeHelperThreadsInUse.load();
+    uint32_t granted = 0U;
+    do {
+        granted = (inUse < maxHelpers) ? std::min(requested, maxHelpers - inUse) : 0U;
+    } while ((granted > 0U) && (false == zebinDecodeHelperThreadsInUse.compare_exchange_weak(inUse, inUse + granted)));
+    return granted;
+}
+
+void releaseZebinDecodeHelperThreads(uint32_t count) {
+    zebinDecodeHelperThreadsInUse -= count;
+}
+
+NEO::DecodeError populateKernelDescriptors(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
+                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelsNd, std::string &outErrReason, std::string &outWarning) {
+    std::vector<const NEO::Yaml::Node *> kernelNodes;
+    kernelNodes.reserve(kernelsNd.numChildren);
+    for (const auto &kernelNd : yamlParser.createChildrenRange(kernelsNd)) {
+        kernelNodes.push_back(&kernelNd);
+    }
+
+    auto helpersCount = 0U;
+    auto workersCount = getZebinDecodeWorkersCount(kernelNodes.size());
+    bool workersForcedByDebugFlag = (DebugManager.flags.ZebinDecodeWorkerThreads.get() != -1);
+    if (workersCount > 1U) {
+        helpersCount = workersForcedByDebugFlag ? workersCount - 1 : acquireZebinDecodeHelperThreads(workersCount - 1);
+    }
+    if (helpersCount == 0U) {
+        for (auto kernelNd : kernelNodes) {
+            auto zeInfoErr = populateKernelDescriptor(dst, elf, zebinSections, yamlParser, *kernelNd, outErrReason, outWarning);
+            if (DecodeError::Success != zeInfoErr) {
+                return zeInfoErr;
+            }
+        }
+        return DecodeError::Success;
+    }
+
+    struct KernelDecodeResult {
+        ProgramInfo programInfo;
+        std::string errReason;
+        std::string warning;
+        DecodeError error = DecodeError::Success;
+    };
+    std::vector<KernelDecodeResult> results(kernelNodes.size());
+    std::atomic<size_t> nextKernel{0U};
+    auto decodeKernels = [&]() {
+        for (auto kernelId = nextKernel++; kernelId < kernelNodes.size(); kernelId = nextKernel++) {
+            auto &result = results[kernelId];
+            result.programInfo.grfSize = dst.grfSize;
+            result.error = populateKernelDescriptor(result.programInfo, elf, zebinSections, yamlParser, *kernelNodes[kernelId], result.errReason, result.warning);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(helpersCount);
+    for (auto i = 0U; i < helpersCount; ++i) {
+        workers.emplace_back(decodeKernels);
+    }
+    decodeKernels();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (false == workersForcedByDebugFlag) {
+        releaseZebinDecodeHelperThreads(helpersCount);
+    }
+
+    // merge in kernels order, so that outputs match sequential decoding
+    for (auto &result : results) {
+        outWarning.append(result.warning);
+        if (DecodeError::Success != result.error) {
+            outErrReason.append(result.errReason);
+            return result.error;
+        }
+        dst.kernelInfos.insert(dst.kernelInfos.end(), result.programInfo.kernelInfos.begin(), result.programInfo.kernelInfos.end());
+        result.programInfo.kernelInfos.clear();
+    }
+    return DecodeError::Success;
+}
+
 NEO::DecodeError populateZeInfoVersion(NEO::Elf::ZebinKernelMetadata::Types::Version &dst,
                                        NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &versionNd, std::string &outErrReason, std::string &outWarning) {
     if (nullptr == yamlParser.getValueToken(versionNd)) {
@@ -1154,14 +1252,13 @@ NEO::DecodeError populateZeInfoVersion(NEO::Elf::ZebinKernelMetadata::Types::Ver
     return NEO::DecodeError::Success;
 }
 
-template <>
-DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
-    auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(src.deviceBinary, outErrReason, outWarning);
+DecodeError decodeZebinSections(ProgramInfo &dst, const SingleDeviceBinary &src, Elf::Elf<Elf::EI_CLASS_64> &elf, ZebinSections &zebinSections,
+                                std::string &outErrReason, std::string &outWarning) {
+    elf = Elf::decodeElf<Elf::EI_CLASS_64>(src.deviceBinary, outErrReason, outWarning);
     if (nullptr == elf.elfFileHeader) {
         return DecodeError::InvalidBinary;
     }
 
-    ZebinSections zebinSections;
     auto extractError = extractZebinSections(elf, zebinSections, outErrReason, outWarning);
     if (DecodeError::Success != extractError) {
         return extractError;
@@ -1189,6 +1286,18 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo
         outWarning.append("DeviceBinaryFormat::Zebin : Ignoring symbol table\n");
     }
 
+    return DecodeError::Success;
+}
+
+template <>
+DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo &dst, const SingleDeviceBinary &src, std::string &outErrReason, std::string &outWarning) {
+    Elf::Elf<Elf::EI_CLASS_64> elf;
+    ZebinSections zebinSections;
+    auto sectionsError = decodeZebinSections(dst, src, elf, zebinSections, outErrReason, outWarning);
+    if (DecodeError::Success != sectionsError) {
+        return sectionsError;
+    }
+
     if (zebinSections.zeInfoSections.empty()) {
         outWarning.append("DeviceBinaryFormat::Zebin : Expected at least one " + NEO::Elf::SectionsNamesZebin::zeInfo.str() + " section, got 0\n");
         return DecodeError::Success;
@@ -1256,14 +1365,7 @@ DecodeError decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(ProgramInfo
         return DecodeError::Success;
     }
 
-    for (const auto &kernelNd : yamlParser.createChildrenRange(*kernelsSectionNodes[0])) {
-        auto zeInfoErr = populateKernelDescriptor(dst, elf, zebinSections, yamlParser, kernelNd, outErrReason, outWarning);
-        if (DecodeError::Success != zeInfoErr) {
-            return zeInfoErr;
-        }
-    }
-
-    return DecodeError::Success;
+    return populateKernelDescriptors(dst, elf, zebinSections, yamlParser, *kernelsSectionNodes[0], outErrReason, outWarning);
 }
 
 } // namespace NEO
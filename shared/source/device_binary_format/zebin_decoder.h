@@ -45,6 +45,8 @@ struct ZeInfoKernelSections {
 bool validateTargetDevice(const Elf::Elf<Elf::EI_CLASS_64> &elf, const TargetDevice &targetDevice);
 std::vector<const Elf::IntelGTNote *> getIntelGTNotes(const Elf::Elf<Elf::EI_CLASS_64> &elf);
 
+DecodeError decodeZebinSections(ProgramInfo &dst, const SingleDeviceBinary &src, Elf::Elf<Elf::EI_CLASS_64> &elf, ZebinSections &zebinSections,
+                                std::string &outErrReason, std::string &outWarning);
 DecodeError extractZebinSections(NEO::Elf::Elf<Elf::EI_CLASS_64> &elf, ZebinSections &out, std::string &outErrReason, std::string &outWarning);
 DecodeError validateZebinSectionsCount(const ZebinSections &sections, std::string &outErrReason, std::string &outWarning);
 void extractZeInfoKernelSections(const NEO::Yaml::YamlParser &parser, const NEO::Yaml::Node &kernelNd, ZeInfoKernelSections &outZeInfoKernelSections, ConstStringRef context, std::string &outWarning);
@@ -104,6 +106,16 @@ NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Type
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning);
 
+static constexpr size_t minKernelsCountForParallelZebinDecode = 256U;
+static constexpr size_t minKernelsCountPerZebinDecodeWorker = 64U;
+static constexpr uint32_t maxZebinDecodeWorkersCount = 4U;
+uint32_t getZebinDecodeWorkersCount(size_t kernelsCount);
+uint32_t acquireZebinDecodeHelperThreads(uint32_t requested);
+void releaseZebinDecodeHelperThreads(uint32_t count);
+
+NEO::DecodeError populateKernelDescriptors(NEO::ProgramInfo &dst, NEO::Elf::Elf<NEO::Elf::EI_CLASS_64> &elf, NEO::ZebinSections &zebinSections,
+                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelsNd, std::string &outErrReason, std::string &outWarning);
+
 NEO::DecodeError populateZeInfoVersion(NEO::Elf::ZebinKernelMetadata::Types::Version &dst,
                                        NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &versionNd, std::string &outErrReason, std::string &outWarning);
 } // namespace NEO
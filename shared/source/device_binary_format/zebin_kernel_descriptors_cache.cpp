@@ -0,0 +1,470 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/zebin_kernel_descriptors_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device_binary_format/zebin_decoder.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/program/program_info.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include "driver_version.h"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <type_traits>
+
+#ifdef QTR
+#undef QTR
+#endif
+
+#ifdef TOSTR
+#undef TOSTR
+#endif
+
+#define QTR(a) #a
+#define TOSTR(b) QTR(b)
+
+namespace NEO {
+
+namespace ZebinKernelDescriptorsCache {
+
+namespace {
+
+using ByValueArgumentT = decltype(KernelDescriptor::kernelMetadata.allByValueKernelArguments)::value_type;
+
+struct KernelHeapsLayout {
+    uint32_t sshOffset = 0U;
+    uint32_t sshSize = 0U;
+    uint32_t dshOffset = 0U;
+    uint32_t dshSize = 0U;
+};
+
+class Writer {
+  public:
+    Writer(std::vector<uint8_t> &out) : out(out) {}
+
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void *data, size_t size) {
+        auto pos = out.size();
+        out.resize(pos + size);
+        if (size > 0U) {
+            memcpy(out.data() + pos, data, size);
+        }
+    }
+
+    void writeString(const std::string &str) {
+        write(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+  protected:
+    std::vector<uint8_t> &out;
+};
+
+class Reader {
+  public:
+    Reader(ArrayRef<const uint8_t> data) : pos(data.begin()), end(data.end()) {}
+
+    template <typename T>
+    bool read(T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool readBytes(void *data, size_t size) {
+        if (static_cast<size_t>(end - pos) < size) {
+            return false;
+        }
+        if (size > 0U) {
+            memcpy(data, pos, size);
+        }
+        pos += size;
+        return true;
+    }
+
+    bool readString(std::string &str) {
+        uint32_t size = 0U;
+        if ((false == read(size)) || (static_cast<size_t>(end - pos) < size)) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const char *>(pos), size);
+        pos += size;
+        return true;
+    }
+
+    bool isAtEnd() const {
+        return pos == end;
+    }
+
+  protected:
+    const uint8_t *pos = nullptr;
+    const uint8_t *end = nullptr;
+};
+
+bool isSerializable(const KernelInfo &kernelInfo) {
+    const auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    return kernelDescriptor.payloadMappings.explicitArgsExtendedDescriptors.empty() &&
+           kernelDescriptor.kernelMetadata.printfStringsMap.empty() &&
+           kernelDescriptor.kernelMetadata.deviceSideEnqueueChildrenKernelsIdOffset.empty() &&
+           (nullptr == kernelDescriptor.external.debugData) &&
+           (nullptr == kernelDescriptor.extendedInfo) &&
+           (nullptr == kernelInfo.heapInfo.pGsh);
+}
+
+bool getHeapOffset(const KernelInfo &kernelInfo, const void *heap, uint32_t heapSize, uint32_t &outOffset) {
+    const auto &generatedHeaps = kernelInfo.kernelDescriptor.generatedHeaps;
+    auto heapsBegin = reinterpret_cast<uintptr_t>(generatedHeaps.data());
+    auto heapBegin = reinterpret_cast<uintptr_t>(heap);
+    if ((heapBegin < heapsBegin) || (heapBegin + heapSize > heapsBegin + generatedHeaps.size())) {
+        return (nullptr == heap) && (0U == heapSize);
+    }
+    outOffset = static_cast<uint32_t>(heapBegin - heapsBegin);
+    return true;
+}
+
+void serializeArg(Writer &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo().packed);
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        const auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+        break;
+    }
+    }
+}
+
+bool deserializeArg(Reader &reader, ArgDescriptor &arg) {
+    ArgDescriptor::ArgType type = ArgDescriptor::ArgTUnknown;
+    ArgTypeTraits traits;
+    uint32_t extendedTypeInfo = 0U;
+    if ((false == reader.read(type)) || (false == reader.read(traits)) || (false == reader.read(extendedTypeInfo))) {
+        return false;
+    }
+
+    bool valid = true;
+    switch (type) {
+    default:
+        return false;
+    case ArgDescriptor::ArgTUnknown:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        valid = reader.read(arg.as<ArgDescPointer>(true));
+        break;
+    case ArgDescriptor::ArgTImage:
+        valid = reader.read(arg.as<ArgDescImage>(true));
+        break;
+    case ArgDescriptor::ArgTSampler:
+        valid = reader.read(arg.as<ArgDescSampler>(true));
+        break;
+    case ArgDescriptor::ArgTValue: {
+        auto &elements = arg.as<ArgDescValue>(true).elements;
+        uint32_t elementsCount = 0U;
+        valid = reader.read(elementsCount);
+        for (uint32_t i = 0; valid && (i < elementsCount); ++i) {
+            ArgDescValue::Element element;
+            valid = reader.read(element);
+            elements.push_back(element);
+        }
+        break;
+    }
+    }
+    arg.getTraits() = traits;
+    arg.getExtendedTypeInfo().packed = extendedTypeInfo;
+    return valid;
+}
+
+bool serializeKernel(Writer &writer, const KernelInfo &kernelInfo) {
+    if (false == isSerializable(kernelInfo)) {
+        return false;
+    }
+
+    KernelHeapsLayout heapsLayout;
+    heapsLayout.sshSize = kernelInfo.heapInfo.SurfaceStateHeapSize;
+    heapsLayout.dshSize = kernelInfo.heapInfo.DynamicStateHeapSize;
+    if ((false == getHeapOffset(kernelInfo, kernelInfo.heapInfo.pSsh, heapsLayout.sshSize, heapsLayout.sshOffset)) ||
+        (false == getHeapOffset(kernelInfo, kernelInfo.heapInfo.pDsh, heapsLayout.dshSize, heapsLayout.dshOffset))) {
+        return false;
+    }
+
+    const auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    const auto &payloadMappings = kernelDescriptor.payloadMappings;
+    const auto &kernelMetadata = kernelDescriptor.kernelMetadata;
+    writer.writeString(kernelMetadata.kernelName);
+    writer.writeString(kernelMetadata.kernelLanguageAttributes);
+    writer.write(kernelMetadata.compiledSubGroupsNumber);
+    writer.write(kernelMetadata.requiredSubGroupSize);
+    writer.write(kernelDescriptor.kernelAttributes);
+    writer.write(kernelDescriptor.entryPoints);
+    writer.write(payloadMappings.dispatchTraits);
+    writer.write(payloadMappings.bindingTable);
+    writer.write(payloadMappings.samplerTable);
+    writer.write(payloadMappings.implicitArgs);
+
+    writer.write(static_cast<uint32_t>(payloadMappings.explicitArgs.size()));
+    for (const auto &arg : payloadMappings.explicitArgs) {
+        serializeArg(writer, arg);
+    }
+
+    writer.write(static_cast<uint32_t>(kernelDescriptor.explicitArgsExtendedMetadata.size()));
+    for (const auto &argMetadata : kernelDescriptor.explicitArgsExtendedMetadata) {
+        writer.writeString(argMetadata.argName);
+        writer.writeString(argMetadata.type);
+        writer.writeString(argMetadata.accessQualifier);
+        writer.writeString(argMetadata.addressQualifier);
+        writer.writeString(argMetadata.typeQualifiers);
+    }
+
+    writer.write(static_cast<uint32_t>(kernelMetadata.allByValueKernelArguments.size()));
+    for (const auto &byValueArgument : kernelMetadata.allByValueKernelArguments) {
+        writer.write(byValueArgument);
+    }
+
+    writer.write(static_cast<uint32_t>(kernelDescriptor.generatedHeaps.size()));
+    writer.writeBytes(kernelDescriptor.generatedHeaps.data(), kernelDescriptor.generatedHeaps.size());
+    writer.write(heapsLayout);
+    return true;
+}
+
+bool deserializeKernel(Reader &reader, KernelInfo &kernelInfo, KernelHeapsLayout &outHeapsLayout) {
+    auto &kernelDescriptor = kernelInfo.kernelDescriptor;
+    auto &payloadMappings = kernelDescriptor.payloadMappings;
+    auto &kernelMetadata = kernelDescriptor.kernelMetadata;
+    bool valid = reader.readString(kernelMetadata.kernelName);
+    valid = valid && reader.readString(kernelMetadata.kernelLanguageAttributes);
+    valid = valid && reader.read(kernelMetadata.compiledSubGroupsNumber);
+    valid = valid && reader.read(kernelMetadata.requiredSubGroupSize);
+    valid = valid && reader.read(kernelDescriptor.kernelAttributes);
+    valid = valid && reader.read(kernelDescriptor.entryPoints);
+    valid = valid && reader.read(payloadMappings.dispatchTraits);
+    valid = valid && reader.read(payloadMappings.bindingTable);
+    valid = valid && reader.read(payloadMappings.samplerTable);
+    valid = valid && reader.read(payloadMappings.implicitArgs);
+
+    uint32_t explicitArgsCount = 0U;
+    valid = valid && reader.read(explicitArgsCount);
+    if (valid) {
+        payloadMappings.explicitArgs.resize(explicitArgsCount);
+    }
+    for (uint32_t i = 0; valid && (i < explicitArgsCount); ++i) {
+        valid = deserializeArg(reader, payloadMappings.explicitArgs[i]);
+    }
+
+    uint32_t argsMetadataCount = 0U;
+    valid = valid && reader.read(argsMetadataCount);
+    if (valid) {
+        kernelDescriptor.explicitArgsExtendedMetadata.resize(argsMetadataCount);
+    }
+    for (uint32_t i = 0; valid && (i < argsMetadataCount); ++i) {
+        auto &argMetadata = kernelDescriptor.explicitArgsExtendedMetadata[i];
+        valid = reader.readString(argMetadata.argName) &&
+                reader.readString(argMetadata.type) &&
+                reader.readString(argMetadata.accessQualifier) &&
+                reader.readString(argMetadata.addressQualifier) &&
+                reader.readString(argMetadata.typeQualifiers);
+    }
+
+    uint32_t byValueArgumentsCount = 0U;
+    valid = valid && reader.read(byValueArgumentsCount);
+    for (uint32_t i = 0; valid && (i < byValueArgumentsCount); ++i) {
+        ByValueArgumentT byValueArgument;
+        valid = reader.read(byValueArgument);
+        kernelMetadata.allByValueKernelArguments.push_back(byValueArgument);
+    }
+
+    uint32_t generatedHeapsSize = 0U;
+    valid = valid && reader.read(generatedHeapsSize);
+    if (valid) {
+        kernelDescriptor.generatedHeaps.resize(generatedHeapsSize);
+        valid = reader.readBytes(kernelDescriptor.generatedHeaps.data(), generatedHeapsSize);
+    }
+    valid = valid && reader.read(outHeapsLayout);
+    valid = valid && (static_cast<uint64_t>(outHeapsLayout.sshOffset) + outHeapsLayout.sshSize <= generatedHeapsSize);
+    valid = valid && (static_cast<uint64_t>(outHeapsLayout.dshOffset) + outHeapsLayout.dshSize <= generatedHeapsSize);
+    return valid;
+}
+
+} // namespace
+
+uint64_t getDriverFingerprint() {
+    Hash hash;
+#ifdef NEO_REVISION
+    hash.update(NEO_REVISION, sizeof(NEO_REVISION));
+#endif
+#ifdef NEO_OCL_DRIVER_VERSION
+    hash.update(TOSTR(NEO_OCL_DRIVER_VERSION), sizeof(TOSTR(NEO_OCL_DRIVER_VERSION)));
+#endif
+    const uint64_t layout[] = {sizeof(Header),
+                               sizeof(KernelDescriptor::kernelAttributes),
+                               sizeof(KernelDescriptor::entryPoints),
+                               sizeof(KernelDescriptor::payloadMappings.dispatchTraits),
+                               sizeof(KernelDescriptor::payloadMappings.bindingTable),
+                               sizeof(KernelDescriptor::payloadMappings.samplerTable),
+                               sizeof(KernelDescriptor::payloadMappings.implicitArgs),
+                               sizeof(KernelDescriptor::kernelMetadata.compiledSubGroupsNumber),
+                               sizeof(KernelDescriptor::kernelMetadata.requiredSubGroupSize),
+                               sizeof(ArgDescriptor::ArgType),
+                               sizeof(ArgTypeTraits),
+                               sizeof(ArgDescPointer),
+                               sizeof(ArgDescImage),
+                               sizeof(ArgDescSampler),
+                               sizeof(ArgDescValue::Element),
+                               sizeof(ByValueArgumentT),
+                               sizeof(KernelHeapsLayout)};
+    hash.update(reinterpret_cast<const char *>(layout), sizeof(layout));
+    return hash.finish();
+}
+
+uint64_t getDeviceBinaryHash(ArrayRef<const uint8_t> deviceBinary) {
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(deviceBinary.begin()), deviceBinary.size());
+    return hash.finish();
+}
+
+std::string getCacheEntryName(ArrayRef<const uint8_t> deviceBinary) {
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::setw(sizeof(uint64_t) * 2)
+           << std::hex
+           << getDeviceBinaryHash(deviceBinary)
+           << "_kd" << std::dec << version
+           << "_" << std::hex << std::setw(sizeof(uint64_t) * 2) << getDriverFingerprint();
+    //decoded kernel arguments depend on this flag
+    if (DebugManager.flags.ZebinAppendElws.get()) {
+        stream << "_elws";
+    }
+    return stream.str();
+}
+
+bool serialize(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary, const std::string &decodeWarnings, std::vector<uint8_t> &out) {
+    std::vector<uint8_t> serialized;
+    Writer writer(serialized);
+
+    Header header;
+    header.magic = magic;
+    header.version = version;
+    header.driverFingerprint = getDriverFingerprint();
+    header.deviceBinarySize = deviceBinary.size();
+    header.grfSize = programInfo.grfSize;
+    header.kernelsCount = static_cast<uint32_t>(programInfo.kernelInfos.size());
+    writer.write(header);
+    writer.writeString(decodeWarnings);
+
+    for (const auto kernelInfo : programInfo.kernelInfos) {
+        if (false == serializeKernel(writer, *kernelInfo)) {
+            return false;
+        }
+    }
+
+    out = std::move(serialized);
+    return true;
+}
+
+DecodeError deserialize(ProgramInfo &dst, const SingleDeviceBinary &src, ArrayRef<const uint8_t> serialized, std::string &outErrReason, std::string &outWarning) {
+    Reader reader(serialized);
+    Header header;
+    if ((false == reader.read(header)) || (magic != header.magic) || (version != header.version) || (getDriverFingerprint() != header.driverFingerprint)) {
+        outErrReason.append("ZebinKernelDescriptorsCache : Invalid or outdated cache entry\n");
+        return DecodeError::InvalidBinary;
+    }
+
+    if ((header.deviceBinarySize != src.deviceBinary.size()) || (header.grfSize != src.targetDevice.grfSize)) {
+        outErrReason.append("ZebinKernelDescriptorsCache : Cache entry doesn't match device binary\n");
+        return DecodeError::InvalidBinary;
+    }
+
+    std::string decodeWarnings;
+    if (false == reader.readString(decodeWarnings)) {
+        outErrReason.append("ZebinKernelDescriptorsCache : Corrupted cache entry\n");
+        return DecodeError::InvalidBinary;
+    }
+
+    //section warnings are already part of the stored decode warnings
+    std::string sectionsWarnings;
+    Elf::Elf<Elf::EI_CLASS_64> elf;
+    ZebinSections zebinSections;
+    ProgramInfo programInfo;
+    auto sectionsError = decodeZebinSections(programInfo, src, elf, zebinSections, outErrReason, sectionsWarnings);
+    if (DecodeError::Success != sectionsError) {
+        return sectionsError;
+    }
+
+    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+    for (uint32_t kernelId = 0; kernelId < header.kernelsCount; ++kernelId) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        KernelHeapsLayout heapsLayout;
+        if (false == deserializeKernel(reader, *kernelInfo, heapsLayout)) {
+            outErrReason.append("ZebinKernelDescriptorsCache : Corrupted cache entry\n");
+            return DecodeError::InvalidBinary;
+        }
+
+        ZebinSections::SectionHeaderData *correspondingTextSegment = nullptr;
+        for (auto *textSection : zebinSections.textKernelSections) {
+            ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
+            auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+            if (sufix == kernelInfo->kernelDescriptor.kernelMetadata.kernelName) {
+                correspondingTextSegment = textSection;
+            }
+        }
+        if (nullptr == correspondingTextSegment) {
+            outErrReason.append("ZebinKernelDescriptorsCache : Could not find text section for kernel " + kernelInfo->kernelDescriptor.kernelMetadata.kernelName + "\n");
+            return DecodeError::InvalidBinary;
+        }
+
+        auto generatedHeaps = kernelInfo->kernelDescriptor.generatedHeaps.data();
+        kernelInfo->heapInfo.pKernelHeap = correspondingTextSegment->data.begin();
+        kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
+        kernelInfo->heapInfo.KernelUnpaddedSize = static_cast<uint32_t>(correspondingTextSegment->data.size());
+        kernelInfo->heapInfo.pSsh = ptrOffset(generatedHeaps, heapsLayout.sshOffset);
+        kernelInfo->heapInfo.SurfaceStateHeapSize = heapsLayout.sshSize;
+        kernelInfo->heapInfo.pDsh = ptrOffset(generatedHeaps, heapsLayout.dshOffset);
+        kernelInfo->heapInfo.DynamicStateHeapSize = heapsLayout.dshSize;
+        programInfo.kernelInfos.push_back(kernelInfo.release());
+    }
+
+    if (false == reader.isAtEnd()) {
+        outErrReason.append("ZebinKernelDescriptorsCache : Corrupted cache entry\n");
+        return DecodeError::InvalidBinary;
+    }
+
+    outWarning.append(decodeWarnings);
+    dst = std::move(programInfo);
+    return DecodeError::Success;
+}
+
+} // namespace ZebinKernelDescriptorsCache
+
+} // namespace NEO
+
+#undef QTR
+#undef TOSTR
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace NEO {
+struct ProgramInfo;
+
+namespace ZebinKernelDescriptorsCache {
+
+// flat, versioned image of kernel descriptors decoded from zebin, entries are named after hash of the zebin
+struct Header {
+    uint32_t magic = 0U;
+    uint32_t version = 0U;
+    uint64_t driverFingerprint = 0U;
+    uint64_t deviceBinarySize = 0U;
+    uint32_t grfSize = 0U;
+    uint32_t kernelsCount = 0U;
+};
+
+static constexpr uint32_t magic = 0x444b454eU; // 'NEKD'
+static constexpr uint32_t version = 2U;
+
+// driver revision and sizes of structures copied verbatim into the entry
+uint64_t getDriverFingerprint();
+uint64_t getDeviceBinaryHash(ArrayRef<const uint8_t> deviceBinary);
+std::string getCacheEntryName(ArrayRef<const uint8_t> deviceBinary);
+
+bool serialize(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary, const std::string &decodeWarnings, std::vector<uint8_t> &out);
+DecodeError deserialize(ProgramInfo &dst, const SingleDeviceBinary &src, ArrayRef<const uint8_t> serialized, std::string &outErrReason, std::string &outWarning);
+
+} // namespace ZebinKernelDescriptorsCache
+
+} // namespace NEO
@@ -9,7 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 
-#include <chrono>
+#include <algorithm>
 
 namespace NEO {
 
@@ -19,20 +19,37 @@ DirectSubmissionController::DirectSubmissionController() {
     if (DebugManager.flags.DirectSubmissionControllerTimeout.get() != -1) {
         timeout = DebugManager.flags.DirectSubmissionControllerTimeout.get();
     }
+    if (DebugManager.flags.DirectSubmissionControllerMinTimeout.get() != -1) {
+        minTimeout = DebugManager.flags.DirectSubmissionControllerMinTimeout.get();
+    }
+    minTimeout = std::min(minTimeout, timeout);
+    if (DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get() != -1) {
+        adaptiveTimeout = !!DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get();
+    }
 
     directSubmissionControllingThread = std::thread(&DirectSubmissionController::controlDirectSubmissionsState, this);
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
     keepControlling.store(false);
+    {
+        std::lock_guard<std::mutex> lock(condVarMutex);
+        condVar.notify_all();
+    }
     if (directSubmissionControllingThread.joinable()) {
         directSubmissionControllingThread.join();
     }
 }
 
 void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver *csr) {
-    std::lock_guard<std::mutex> lock(directSubmissionsMutex);
-    directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
+    {
+        std::lock_guard<std::mutex> lock(directSubmissionsMutex);
+        DirectSubmissionState state;
+        state.lastActivityTimestamp = getCpuTimestamp();
+        state.timeout = getMaxTimeout();
+        directSubmissions.insert(std::make_pair(csr, state));
+    }
+    wakeUpController();
 }
 
 void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceiver *csr) {
@@ -40,49 +57,149 @@ void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceive
     directSubmissions.erase(csr);
 }
 
+void DirectSubmissionController::notifyRingStarted(const OsContext &osContext) {
+    {
+        std::lock_guard<std::mutex> lock(condVarMutex);
+        if (std::find(restartedOsContexts.begin(), restartedOsContexts.end(), &osContext) == restartedOsContexts.end()) {
+            restartedOsContexts.push_back(&osContext);
+        }
+    }
+    wakeUpController();
+}
+
+void DirectSubmissionController::wakeUpController() {
+    ringStartPending.store(true);
+    if (controllerSleeping.load()) {
+        std::lock_guard<std::mutex> lock(condVarMutex);
+        condVar.notify_one();
+    }
+}
+
 void DirectSubmissionController::controlDirectSubmissionsState() {
     while (true) {
+        if (!this->waitForActiveDirectSubmission()) {
+            return;
+        }
 
-        auto start = std::chrono::steady_clock::now();
-        int diff = 0u;
-        do {
-            if (!keepControlling.load()) {
-                return;
-            }
-
-            auto timestamp = std::chrono::steady_clock::now();
-            diff = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(timestamp - start).count());
-        } while (diff <= timeout);
+        {
+            std::unique_lock<std::mutex> lock(condVarMutex);
+            condVar.wait_for(lock, getCheckPeriod(), [this] { return !keepControlling.load(); });
+        }
+        if (!keepControlling.load()) {
+            return;
+        }
 
         this->checkNewSubmissions();
     }
 }
 
+bool DirectSubmissionController::waitForActiveDirectSubmission() {
+    {
+        std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+        auto isActive = std::any_of(directSubmissions.begin(), directSubmissions.end(), [](const auto &directSubmission) {
+            return !directSubmission.second.isStopped;
+        });
+        if (isActive) {
+            return keepControlling.load();
+        }
+    }
+
+    controllerSleeping.store(true);
+    {
+        std::unique_lock<std::mutex> lock(condVarMutex);
+        condVar.wait(lock, [this] { return ringStartPending.load() || !keepControlling.load(); });
+    }
+    controllerSleeping.store(false);
+
+    if (ringStartPending.exchange(false)) {
+        auto restarted = takeRestartedOsContexts();
+        std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+        markRestarted(restarted, getCpuTimestamp());
+    }
+    return keepControlling.load();
+}
+
+std::vector<const OsContext *> DirectSubmissionController::takeRestartedOsContexts() {
+    std::vector<const OsContext *> restarted;
+    std::lock_guard<std::mutex> lock(condVarMutex);
+    restarted.swap(restartedOsContexts);
+    return restarted;
+}
+
+void DirectSubmissionController::markRestarted(const std::vector<const OsContext *> &restarted, SteadyClock::time_point timestamp) {
+    // called with directSubmissionsMutex held
+    for (auto &directSubmission : this->directSubmissions) {
+        auto &state = directSubmission.second;
+        auto osContext = &directSubmission.first->getOsContext();
+        if (state.isStopped && std::find(restarted.begin(), restarted.end(), osContext) != restarted.end()) {
+            state.isStopped = false;
+            state.lastActivityTimestamp = timestamp;
+        }
+    }
+}
+
 void DirectSubmissionController::checkNewSubmissions() {
+    auto restarted = takeRestartedOsContexts();
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    auto timestamp = getCpuTimestamp();
+    markRestarted(restarted, timestamp);
 
     for (auto &directSubmission : this->directSubmissions) {
         auto csr = directSubmission.first;
         auto &state = directSubmission.second;
 
         auto taskCount = csr->peekTaskCount();
-        if (taskCount <= *csr->getTagAddress()) {
-            if (taskCount == state.taskCount) {
-                if (state.isStopped) {
-                    continue;
-                } else {
-                    auto lock = csr->obtainUniqueOwnership();
-                    csr->stopDirectSubmission();
-                    state.isStopped = true;
-                }
-            } else {
-                state.isStopped = false;
-                state.taskCount = taskCount;
-            }
-        } else {
+        if (taskCount != state.taskCount) {
+            updateSubmissionStatistics(state, timestamp, taskCount);
+            state.lastActivityTimestamp = timestamp;
             state.isStopped = false;
+        } else if (taskCount > *csr->getTagAddress()) {
+            state.lastActivityTimestamp = timestamp;
+            state.isStopped = false;
+        } else if (!state.isStopped && timestamp - state.lastActivityTimestamp >= state.timeout) {
+            auto lock = csr->obtainUniqueOwnership();
+            csr->stopDirectSubmission();
+            state.isStopped = true;
+        }
+    }
+}
+
+void DirectSubmissionController::updateSubmissionStatistics(DirectSubmissionState &state, SteadyClock::time_point timestamp, uint32_t taskCount) {
+    auto maxTimeout = getMaxTimeout();
+    if (adaptiveTimeout && state.lastSubmissionTimestamp != SteadyClock::time_point{} && taskCount > state.taskCount) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timestamp - state.lastSubmissionTimestamp);
+        auto interArrival = elapsed / (taskCount - state.taskCount);
+        if (state.averageInterArrival.count() == 0) {
+            state.averageInterArrival = interArrival;
+        } else {
+            state.averageInterArrival = (state.averageInterArrival * (interArrivalAverageWeight - 1) + interArrival) / interArrivalAverageWeight;
+        }
+
+        std::chrono::microseconds adaptedMinTimeout = std::chrono::milliseconds(minTimeout);
+        if (state.averageInterArrival < maxTimeout) {
+            // submissions arrive before ring would time out, keep it running long enough to avoid restart
+            state.timeout = std::clamp(std::chrono::microseconds(state.averageInterArrival * adaptiveTimeoutMultiplier), adaptedMinTimeout, maxTimeout);
+        } else {
+            // ring would be stopped before next submission anyway, stop it as soon as possible
+            state.timeout = adaptedMinTimeout;
         }
+    } else {
+        state.timeout = maxTimeout;
     }
+    state.lastSubmissionTimestamp = timestamp;
+    state.taskCount = taskCount;
+}
+
+std::chrono::microseconds DirectSubmissionController::getMaxTimeout() const {
+    return std::chrono::milliseconds(timeout);
+}
+
+std::chrono::microseconds DirectSubmissionController::getCheckPeriod() const {
+    return std::chrono::milliseconds(adaptiveTimeout ? minTimeout : timeout);
+}
+
+DirectSubmissionController::SteadyClock::time_point DirectSubmissionController::getCpuTimestamp() {
+    return SteadyClock::now();
 }
 
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -8,13 +8,17 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class MemoryManager;
 class CommandStreamReceiver;
+class OsContext;
 
 class DirectSubmissionController {
   public:
@@ -23,15 +27,33 @@ class DirectSubmissionController {
 
     void registerDirectSubmission(CommandStreamReceiver *csr);
     void unregisterDirectSubmission(CommandStreamReceiver *csr);
+    void notifyRingStarted(const OsContext &osContext);
+
+    static constexpr uint32_t adaptiveTimeoutMultiplier = 4u;
+    static constexpr uint32_t interArrivalAverageWeight = 8u;
 
   protected:
+    using SteadyClock = std::chrono::steady_clock;
+
     struct DirectSubmissionState {
+        SteadyClock::time_point lastActivityTimestamp = {};
+        SteadyClock::time_point lastSubmissionTimestamp = {};
+        std::chrono::microseconds averageInterArrival{0};
+        std::chrono::microseconds timeout{0};
         bool isStopped = false;
         uint32_t taskCount = 0u;
     };
 
     void controlDirectSubmissionsState();
     void checkNewSubmissions();
+    bool waitForActiveDirectSubmission();
+    void wakeUpController();
+    std::vector<const OsContext *> takeRestartedOsContexts();
+    void markRestarted(const std::vector<const OsContext *> &restarted, SteadyClock::time_point timestamp);
+    void updateSubmissionStatistics(DirectSubmissionState &state, SteadyClock::time_point timestamp, uint32_t taskCount);
+    std::chrono::microseconds getMaxTimeout() const;
+    std::chrono::microseconds getCheckPeriod() const;
+    MOCKABLE_VIRTUAL SteadyClock::time_point getCpuTimestamp();
 
     std::unordered_map<CommandStreamReceiver *, DirectSubmissionState> directSubmissions;
     std::mutex directSubmissionsMutex;
@@ -39,6 +61,14 @@ class DirectSubmissionController {
     std::thread directSubmissionControllingThread;
     std::atomic_bool keepControlling = true;
 
+    std::mutex condVarMutex;
+    std::condition_variable condVar;
+    std::vector<const OsContext *> restartedOsContexts;
+    std::atomic_bool ringStartPending = false;
+    std::atomic_bool controllerSleeping = false;
+
     int timeout = 5;
+    int minTimeout = 1;
+    bool adaptiveTimeout = true;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
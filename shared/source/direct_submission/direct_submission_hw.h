@@ -11,7 +11,9 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <memory>
+#include <vector>
 
 namespace NEO {
 
@@ -36,9 +38,20 @@ struct TagData {
     uint64_t tagValue = 0ull;
 };
 
+struct DirectSubmissionRingStatistics {
+    uint64_t submissions = 0u;
+    uint64_t ringSwitches = 0u;
+    uint64_t ringStalls = 0u;
+    uint64_t ringAllocations = 0u;
+};
+
 namespace UllsDefaults {
 constexpr bool defaultDisableCacheFlush = true;
 constexpr bool defaultDisableMonitorFence = false;
+constexpr uint32_t defaultMaxRingBufferCount = 8u;
+constexpr size_t defaultRingBufferSize = 256 * MemoryConstants::kiloByte;
+constexpr size_t defaultMaxRingBufferSize = 4 * MemoryConstants::megaByte;
+constexpr int64_t defaultRingBufferGrowthThresholdUs = 1000;
 } // namespace UllsDefaults
 
 struct BatchBuffer;
@@ -47,6 +60,7 @@ class FlushStampTracker;
 class GraphicsAllocation;
 struct HardwareInfo;
 class Device;
+class DirectSubmissionController;
 class OsContext;
 
 template <typename GfxFamily, typename Dispatcher>
@@ -67,6 +81,10 @@ class DirectSubmissionHw {
 
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(Device &device, OsContext &osContext);
 
+    const DirectSubmissionRingStatistics &getRingStatistics() const {
+        return ringStatistics;
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -82,6 +100,9 @@ class DirectSubmissionHw {
     virtual uint64_t switchRingBuffers();
     virtual void handleSwitchRingBuffers() = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    GraphicsAllocation *allocateRingBuffer(size_t size);
+    void updateRingBufferSize();
+    virtual bool isCompleted(uint32_t ringBufferIndex) = 0;
     virtual uint64_t updateTagValue() = 0;
     virtual void getTagAddressValue(TagData &tagData) = 0;
 
@@ -117,31 +138,43 @@ class DirectSubmissionHw {
     void dispatchDiagnosticModeSection();
     size_t getDiagnosticModeSection();
 
-    enum RingBufferUse : uint32_t {
-        FirstBuffer,
-        SecondBuffer,
-        MaxBuffers
+    struct RingBufferUse {
+        RingBufferUse() = default;
+        RingBufferUse(FlushStamp completionFence, GraphicsAllocation *ringBuffer, size_t size) : completionFence(completionFence), ringBuffer(ringBuffer), size(size){};
+
+        constexpr static uint32_t initialRingBufferCount = 2u;
+
+        FlushStamp completionFence = 0ull;
+        GraphicsAllocation *ringBuffer = nullptr;
+        size_t size = 0u;
     };
 
     LinearStream ringCommandStream;
-    FlushStamp completionRingBuffers[RingBufferUse::MaxBuffers] = {0ull, 0ull};
+    std::vector<RingBufferUse> ringBuffers;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    DirectSubmissionRingStatistics ringStatistics;
+    std::chrono::steady_clock::time_point ringBufferFillStart;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
 
     Device &device;
     OsContext &osContext;
+    DirectSubmissionController *directSubmissionController = nullptr;
     const HardwareInfo *hwInfo = nullptr;
-    GraphicsAllocation *ringBuffer = nullptr;
-    GraphicsAllocation *ringBuffer2 = nullptr;
     GraphicsAllocation *semaphores = nullptr;
     void *semaphorePtr = nullptr;
     volatile RingSemaphoreData *semaphoreData = nullptr;
     volatile void *workloadModeOneStoreAddress = nullptr;
 
+    size_t ringBufferSize = UllsDefaults::defaultRingBufferSize;
+    size_t maxRingBufferSize = UllsDefaults::defaultMaxRingBufferSize;
+    int64_t ringBufferGrowthThresholdUs = UllsDefaults::defaultRingBufferGrowthThresholdUs;
+
     uint32_t currentQueueWorkCount = 1u;
-    RingBufferUse currentRingBuffer = RingBufferUse::FirstBuffer;
+    uint32_t currentRingBuffer = 0u;
+    uint32_t previousRingBuffer = 0u;
+    uint32_t maxRingBufferCount = UllsDefaults::defaultMaxRingBufferCount;
     uint32_t workloadMode = 0;
     uint32_t workloadModeOneExpectedValue = 0u;
 
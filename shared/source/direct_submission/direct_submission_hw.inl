@@ -10,8 +10,10 @@
 #include "shared/source/command_stream/submissions_aggregator.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/direct_submission/direct_submission_hw.h"
 #include "shared/source/direct_submission/direct_submission_hw_diagnostic_mode.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
@@ -24,6 +26,7 @@
 
 #include "create_direct_submission_hw.inl"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
@@ -45,12 +48,23 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(Device &device,
     if (disableCacheFlushKey != -1) {
         disableCpuCacheFlush = disableCacheFlushKey == 1 ? true : false;
     }
+    if (DebugManager.flags.DirectSubmissionMaxRingBuffers.get() != -1) {
+        maxRingBufferCount = std::max(static_cast<uint32_t>(DebugManager.flags.DirectSubmissionMaxRingBuffers.get()), RingBufferUse::initialRingBufferCount);
+    }
+    if (DebugManager.flags.DirectSubmissionRingBufferGrowthThreshold.get() != -1) {
+        ringBufferGrowthThresholdUs = DebugManager.flags.DirectSubmissionRingBufferGrowthThreshold.get();
+    }
     hwInfo = &device.getHardwareInfo();
+    directSubmissionController = device.getExecutionEnvironment()->getDirectSubmissionController();
     createDiagnostic();
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDirectSubmissionRingStatistics.get(), stdout,
+                       "Direct submission ring statistics: submissions: %llu, ring switches: %llu, ring stalls: %llu, ring allocations: %llu, ring buffer size: %zu\n",
+                       ringStatistics.submissions, ringStatistics.ringSwitches, ringStatistics.ringStalls, ringStatistics.ringAllocations, ringBufferSize);
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -58,20 +72,13 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
 
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
-    constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
-    const AllocationProperties commandStreamAllocationProperties{device.getRootDeviceIndex(),
-                                                                 true, allocationSize,
-                                                                 GraphicsAllocation::AllocationType::RING_BUFFER,
-                                                                 isMultiOsContextCapable, osContext.getDeviceBitfield()};
-    ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
-    UNRECOVERABLE_IF(ringBuffer == nullptr);
-    allocations.push_back(ringBuffer);
 
-    ringBuffer2 = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
-    UNRECOVERABLE_IF(ringBuffer2 == nullptr);
-    allocations.push_back(ringBuffer2);
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
+        auto ringBuffer = allocateRingBuffer(ringBufferSize);
+        UNRECOVERABLE_IF(ringBuffer == nullptr);
+        ringBuffers.emplace_back(0ull, ringBuffer, ringBufferSize);
+        allocations.push_back(ringBuffer);
+    }
 
     const AllocationProperties semaphoreAllocationProperties{device.getRootDeviceIndex(),
                                                              true, MemoryConstants::pageSize,
@@ -82,11 +89,10 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     allocations.push_back(semaphores);
 
     handleResidency();
-    ringCommandStream.replaceBuffer(ringBuffer->getUnderlyingBuffer(), minimumRequiredSize);
-    ringCommandStream.replaceGraphicsAllocation(ringBuffer);
+    ringCommandStream.replaceBuffer(ringBuffers[0u].ringBuffer->getUnderlyingBuffer(), ringBuffers[0u].size);
+    ringCommandStream.replaceGraphicsAllocation(ringBuffers[0u].ringBuffer);
+    ringBufferFillStart = std::chrono::steady_clock::now();
 
-    memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
-    memset(ringBuffer2->getUnderlyingBuffer(), 0, allocationSize);
     semaphorePtr = semaphores->getUnderlyingBuffer();
     semaphoreGpuVa = semaphores->getGpuAddress();
     semaphoreData = static_cast<volatile RingSemaphoreData *>(semaphorePtr);
@@ -103,6 +109,24 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     return ret && allocateOsResources();
 }
 
+template <typename GfxFamily, typename Dispatcher>
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer(size_t size) {
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
+    MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
+    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
+    const auto allocationSize = alignUp(size + additionalAllocationSize, MemoryConstants::pageSize64k);
+    const AllocationProperties commandStreamAllocationProperties{device.getRootDeviceIndex(),
+                                                                 true, allocationSize,
+                                                                 GraphicsAllocation::AllocationType::RING_BUFFER,
+                                                                 isMultiOsContextCapable, osContext.getDeviceBitfield()};
+    auto ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+    if (ringBuffer != nullptr) {
+        memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
+        ringStatistics.ringAllocations++;
+    }
+    return ringBuffer;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::makeResourcesResident(DirectSubmissionAllocations &allocations) {
     auto memoryInterface = this->device.getRootDeviceEnvironment().memoryOperationsInterface.get();
@@ -170,6 +194,11 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::startRingBuffer() {
     dispatchSemaphoreSection(currentQueueWorkCount);
 
     ringStart = submit(gpuStartVa, startSize);
+    if (ringStart) {
+        if (directSubmissionController) {
+            directSubmissionController->notifyRingStarted(osContext);
+        }
+    }
 
     return ringStart;
 }
@@ -359,6 +388,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
+    ringStatistics.submissions++;
 
     uint64_t flushValue = updateTagValue();
     flushStamp.setStamp(flushValue);
@@ -398,7 +428,7 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
         cpuCachelineFlush(flushPtr, getSizeSwitchRingBufferSection());
     }
 
-    ringCommandStream.replaceBuffer(nextRingBuffer->getUnderlyingBuffer(), ringCommandStream.getMaxAvailableSpace());
+    ringCommandStream.replaceBuffer(nextRingBuffer->getUnderlyingBuffer(), ringBuffers[currentRingBuffer].size);
     ringCommandStream.replaceGraphicsAllocation(nextRingBuffer);
 
     handleSwitchRingBuffers();
@@ -408,29 +438,65 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
 
 template <typename GfxFamily, typename Dispatcher>
 inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersAllocations() {
+    ringStatistics.ringSwitches++;
+    previousRingBuffer = currentRingBuffer;
+
     GraphicsAllocation *nextAllocation = nullptr;
-    if (currentRingBuffer == RingBufferUse::FirstBuffer) {
-        nextAllocation = ringBuffer2;
-        currentRingBuffer = RingBufferUse::SecondBuffer;
-    } else {
-        nextAllocation = ringBuffer;
-        currentRingBuffer = RingBufferUse::FirstBuffer;
+    auto ringBufferCount = static_cast<uint32_t>(ringBuffers.size());
+    for (uint32_t offset = 1u; offset < ringBufferCount; offset++) {
+        auto ringBufferIndex = (currentRingBuffer + offset) % ringBufferCount;
+        if (isCompleted(ringBufferIndex)) {
+            currentRingBuffer = ringBufferIndex;
+            nextAllocation = ringBuffers[ringBufferIndex].ringBuffer;
+            break;
+        }
+    }
+
+    if (nextAllocation == nullptr && ringBufferCount < maxRingBufferCount) {
+        updateRingBufferSize();
+        nextAllocation = allocateRingBuffer(ringBufferSize);
+        if (nextAllocation != nullptr) {
+            DirectSubmissionAllocations allocations;
+            allocations.push_back(nextAllocation);
+            UNRECOVERABLE_IF(!makeResourcesResident(allocations));
+            currentRingBuffer = ringBufferCount;
+            ringBuffers.emplace_back(0ull, nextAllocation, ringBufferSize);
+        }
+    }
+
+    if (nextAllocation == nullptr) {
+        currentRingBuffer = (currentRingBuffer + 1) % ringBufferCount;
+        nextAllocation = ringBuffers[currentRingBuffer].ringBuffer;
+        if (!isCompleted(currentRingBuffer)) {
+            ringStatistics.ringStalls++;
+        }
     }
+
+    ringBufferFillStart = std::chrono::steady_clock::now();
     return nextAllocation;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+inline void DirectSubmissionHw<GfxFamily, Dispatcher>::updateRingBufferSize() {
+    if (ringBufferGrowthThresholdUs <= 0 || ringBufferSize >= maxRingBufferSize) {
+        return;
+    }
+    auto fillTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - ringBufferFillStart).count();
+    if (fillTime < ringBufferGrowthThresholdUs) {
+        ringBufferSize = std::min(2 * ringBufferSize, maxRingBufferSize);
+    }
+}
+
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
 
-    if (ringBuffer) {
-        memoryManager->freeGraphicsMemory(ringBuffer);
-        ringBuffer = nullptr;
-    }
-    if (ringBuffer2) {
-        memoryManager->freeGraphicsMemory(ringBuffer2);
-        ringBuffer2 = nullptr;
+    for (auto &ringBufferUse : ringBuffers) {
+        if (ringBufferUse.ringBuffer) {
+            memoryManager->freeGraphicsMemory(ringBufferUse.ringBuffer);
+        }
     }
+    ringBuffers.clear();
     if (semaphores) {
         memoryManager->freeGraphicsMemory(semaphores);
         semaphores = nullptr;
@@ -33,6 +33,7 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     void handleSwitchRingBuffers() override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
+    bool isCompleted(uint32_t ringBufferIndex) override;
 
     void wait(uint32_t taskCountToWait);
 
@@ -133,14 +133,13 @@ void DrmDirectSubmission<GfxFamily, Dispatcher>::handleStopRingBuffer() {
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (this->disableMonitorFence) {
-        auto previousRingBuffer = this->currentRingBuffer == DirectSubmissionHw<GfxFamily, Dispatcher>::RingBufferUse::FirstBuffer ? DirectSubmissionHw<GfxFamily, Dispatcher>::RingBufferUse::SecondBuffer : DirectSubmissionHw<GfxFamily, Dispatcher>::RingBufferUse::FirstBuffer;
         this->currentTagData.tagValue++;
-        this->completionRingBuffers[previousRingBuffer] = this->currentTagData.tagValue;
+        this->ringBuffers[this->previousRingBuffer].completionFence = this->currentTagData.tagValue;
     }
 
     if (this->ringStart) {
-        if (this->completionRingBuffers[this->currentRingBuffer] != 0) {
-            this->wait(static_cast<uint32_t>(this->completionRingBuffers[this->currentRingBuffer]));
+        if (this->ringBuffers[this->currentRingBuffer].completionFence != 0) {
+            this->wait(static_cast<uint32_t>(this->ringBuffers[this->currentRingBuffer].completionFence));
         }
     }
 }
@@ -149,11 +148,17 @@ template <typename GfxFamily, typename Dispatcher>
 uint64_t DrmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
     if (!this->disableMonitorFence) {
         this->currentTagData.tagValue++;
-        this->completionRingBuffers[this->currentRingBuffer] = this->currentTagData.tagValue;
+        this->ringBuffers[this->currentRingBuffer].completionFence = this->currentTagData.tagValue;
     }
     return 0ull;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DrmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    auto taskCount = this->ringBuffers[ringBufferIndex].completionFence;
+    return taskCount <= *this->tagAddress;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::getTagAddressValue(TagData &tagData) {
     tagData.tagAddress = this->currentTagData.tagAddress;
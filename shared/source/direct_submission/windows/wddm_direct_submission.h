@@ -33,6 +33,7 @@ class WddmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     void handleSwitchRingBuffers() override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
+    bool isCompleted(uint32_t ringBufferIndex) override;
 
     OsContextWin *osContextWin;
     Wddm *wddm;
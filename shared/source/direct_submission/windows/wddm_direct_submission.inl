@@ -90,9 +90,9 @@ bool WddmDirectSubmission<GfxFamily, Dispatcher>::handleResidency() {
 template <typename GfxFamily, typename Dispatcher>
 void WddmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (this->ringStart) {
-        if (this->completionRingBuffers[this->currentRingBuffer] != 0) {
+        if (this->ringBuffers[this->currentRingBuffer].completionFence != 0) {
             MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
-            handleCompletionRingBuffer(this->completionRingBuffers[this->currentRingBuffer], currentFence);
+            handleCompletionRingBuffer(this->ringBuffers[this->currentRingBuffer].completionFence, currentFence);
         }
     }
 }
@@ -103,11 +103,18 @@ uint64_t WddmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
 
     currentFence.lastSubmittedFence = currentFence.currentFenceValue;
     currentFence.currentFenceValue++;
-    this->completionRingBuffers[this->currentRingBuffer] = currentFence.lastSubmittedFence;
+    this->ringBuffers[this->currentRingBuffer].completionFence = currentFence.lastSubmittedFence;
 
     return currentFence.lastSubmittedFence;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool WddmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
+    auto lastSubmittedFence = this->ringBuffers[ringBufferIndex].completionFence;
+    return lastSubmittedFence <= *currentFence.cpuAddress;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 void WddmDirectSubmission<GfxFamily, Dispatcher>::handleCompletionRingBuffer(uint64_t completionValue, MonitoredFence &fence) {
     wddm->waitFromCpu(completionValue, fence);
@@ -93,6 +93,7 @@ DirectSubmissionController *ExecutionEnvironment::getDirectSubmissionController(
         initializeDirectSubmissionController = DebugManager.flags.EnableDirectSubmissionController.get();
     }
 
+    std::lock_guard<std::mutex> lock(directSubmissionControllerMutex);
     if (initializeDirectSubmissionController && this->directSubmissionController == nullptr) {
         this->directSubmissionController = std::make_unique<DirectSubmissionController>();
     }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/utilities/reference_tracked_object.h"
 
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -39,6 +40,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
   protected:
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::mutex directSubmissionControllerMutex;
 
     bool debuggingEnabled = false;
 };
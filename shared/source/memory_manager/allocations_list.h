@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <atomic>
+#include <map>
 #include <mutex>
 
 namespace NEO {
@@ -18,10 +20,36 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
   public:
     AllocationsList(AllocationUsage allocationUsage);
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
+    std::unique_ptr<GraphicsAllocation> detachOldestCompletedAllocation(CommandStreamReceiver &commandStreamReceiver);
+
+    void pushTailOne(GraphicsAllocation &allocation);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &allocations);
+    GraphicsAllocation *detachCompletedAllocations(uint32_t completedTaskCount, uint32_t contextId);
+    size_t getTotalSize() const { return totalSize; }
 
   private:
+    // mutators that would bypass the index
+    using IDList::deleteAll;
+    using IDList::detachSequence;
+    using IDList::pushFrontOne;
+    using IDList::removeFrontOne;
+    using IDList::removeOne;
+
+    using AllocationsIndex = std::multimap<std::pair<GraphicsAllocation::AllocationType, size_t>, GraphicsAllocation *>;
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachOldestCompletedAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushTailOneAndIndexImpl(GraphicsAllocation *allocation, void *);
+    GraphicsAllocation *detachNodesAndIndexImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceAndIndexImpl(GraphicsAllocation *allocations, void *);
+    GraphicsAllocation *detachCompletedAllocationsImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *removeFromIndexImpl(GraphicsAllocation &allocation);
+    GraphicsAllocation *removeIndexedImpl(AllocationsIndex::iterator it);
+    void addToIndex(GraphicsAllocation &allocation);
 
     const AllocationUsage allocationUsage;
+    AllocationsIndex allocationsIndex;
+    std::atomic<size_t> totalSize{0u};
 };
 } // namespace NEO
@@ -12,11 +12,18 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 DeferrableAllocationDeletion::DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation) : memoryManager(memoryManager),
                                                                                                                                    graphicsAllocation(graphicsAllocation) {}
 bool DeferrableAllocationDeletion::apply() {
+    std::vector<CommandStreamReceiver *> flushedCsrs;
+    return applyInBatch(flushedCsrs);
+}
+
+bool DeferrableAllocationDeletion::applyInBatch(std::vector<CommandStreamReceiver *> &flushedCsrs) {
     if (graphicsAllocation.isUsed()) {
         bool isStillUsed = false;
         for (auto &engine : memoryManager.getRegisteredEngines()) {
@@ -27,8 +34,12 @@ bool DeferrableAllocationDeletion::apply() {
                     graphicsAllocation.releaseUsageInOsContext(contextId);
                 } else {
                     isStillUsed = true;
-                    engine.commandStreamReceiver->flushBatchedSubmissions();
-                    engine.commandStreamReceiver->updateTagFromWait();
+                    auto commandStreamReceiver = engine.commandStreamReceiver;
+                    if (std::find(flushedCsrs.begin(), flushedCsrs.end(), commandStreamReceiver) == flushedCsrs.end()) {
+                        commandStreamReceiver->flushBatchedSubmissions();
+                        commandStreamReceiver->updateTagFromWait();
+                        flushedCsrs.push_back(commandStreamReceiver);
+                    }
                 }
             }
         }
@@ -39,4 +50,19 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+size_t DeferrableAllocationDeletion::getSize() const {
+    return graphicsAllocation.getUnderlyingBufferSize();
+}
+
+uint32_t DeferrableAllocationDeletion::getPartitionKey() const {
+    // group by the first context still using the allocation, so its command stream receiver is waited on by one worker
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (graphicsAllocation.isUsedByOsContext(contextId)) {
+            return contextId;
+        }
+    }
+    return 0u;
+}
 } // namespace NEO
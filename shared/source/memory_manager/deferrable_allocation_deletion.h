@@ -17,6 +17,9 @@ class DeferrableAllocationDeletion : public DeferrableDeletion {
   public:
     DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation);
     bool apply() override;
+    bool applyInBatch(std::vector<CommandStreamReceiver *> &flushedCsrs) override;
+    size_t getSize() const override;
+    uint32_t getPartitionKey() const override;
 
   protected:
     MemoryManager &memoryManager;
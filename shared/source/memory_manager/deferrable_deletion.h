@@ -8,11 +8,20 @@
 #pragma once
 #include "shared/source/utilities/idlist.h"
 
+#include <vector>
+
 namespace NEO {
+class CommandStreamReceiver;
+
 class DeferrableDeletion : public IDNode<DeferrableDeletion> {
   public:
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
     virtual bool apply() = 0;
+    // command stream receivers in flushedCsrs were already flushed and waited on by earlier deletions in the batch
+    virtual bool applyInBatch(std::vector<CommandStreamReceiver *> &flushedCsrs) { return apply(); }
+    virtual size_t getSize() const { return 0u; }
+    // deletions with the same key are released together by one worker
+    virtual uint32_t getPartitionKey() const { return 0u; }
 };
 } // namespace NEO
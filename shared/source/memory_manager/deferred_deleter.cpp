@@ -7,9 +7,14 @@
 
 #include "shared/source/memory_manager/deferred_deleter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
+#include <map>
+#include <thread>
+
 namespace NEO {
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
@@ -21,19 +26,24 @@ void DeferredDeleter::stop() {
     if (worker != nullptr) {
         // Working thread was created so we can safely stop it
         std::unique_lock<std::mutex> lock(queueMutex);
-        // Make sure that working thread really started
-        while (!doWorkInBackground) {
+        // Make sure that all working threads really started
+        while (!doWorkInBackground || startedWorkers < additionalWorkers.size() + 1) {
             lock.unlock();
             lock.lock();
         }
         // Signal working thread to finish its job
         doWorkInBackground = false;
         lock.unlock();
-        condition.notify_one();
-        // Wait for the working job to exit
+        condition.notify_all();
+        // Wait for the working jobs to exit
         worker->join();
-        // Delete working thread
+        for (auto &additionalWorker : additionalWorkers) {
+            additionalWorker->join();
+        }
+        // Delete working threads
         worker.reset();
+        additionalWorkers.clear();
+        startedWorkers = 0u;
     }
     drain(false);
 }
@@ -50,6 +60,10 @@ DeferredDeleter::~DeferredDeleter() {
 void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     std::unique_lock<std::mutex> lock(queueMutex);
     elementsToRelease++;
+    size_t currentDeferredSize = deferredSize += deletion->getSize();
+    if (currentDeferredSize > peakDeferredSize) {
+        peakDeferredSize = currentDeferredSize;
+    }
     queue.pushTailOne(*deletion);
     lock.unlock();
     condition.notify_one();
@@ -74,6 +88,9 @@ void DeferredDeleter::ensureThread() {
         return;
     }
     worker = Thread::create(run, reinterpret_cast<void *>(this));
+    for (int32_t i = 1; i < DebugManager.flags.DeferredDeleterWorkersCount.get(); i++) {
+        additionalWorkers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
 }
 
 bool DeferredDeleter::areElementsReleased() {
@@ -89,8 +106,9 @@ void *DeferredDeleter::run(void *arg) {
     std::unique_lock<std::mutex> lock(self->queueMutex);
     // Mark that working thread really started
     self->doWorkInBackground = true;
+    self->startedWorkers++;
     do {
-        if (self->queue.peekIsEmpty()) {
+        if (self->queue.peekIsEmpty() && self->pendingGroups.empty()) {
             // Wait for signal that some items are ready to be deleted
             self->condition.wait(lock);
         }
@@ -113,15 +131,65 @@ void DeferredDeleter::drain(bool blocking) {
 }
 
 void DeferredDeleter::clearQueue() {
-    do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
-            if (deletion->apply()) {
-                elementsToRelease--;
-            } else {
-                queue.pushTailOne(*deletion.release());
-            }
+    IDList<DeferrableDeletion, false> notReleased;
+    auto backoff = minReleaseBackoff;
+    while (!releaseDeletions(notReleased)) {
+        // Not released items were already waited on, give the GPU time instead of spinning on them
+        std::this_thread::sleep_for(backoff);
+        backoff = std::min(2 * backoff, maxReleaseBackoff);
+    }
+}
+
+bool DeferredDeleter::releaseDeletions(IDList<DeferrableDeletion, false> &notReleased) {
+    auto retried = notReleased.detachNodes();
+    if (retried) {
+        releaseDeletionsGroup(retried, notReleased);
+    }
+    while (auto group = takeDeletionsGroup()) {
+        releaseDeletionsGroup(group, notReleased);
+    }
+    return notReleased.peekIsEmpty();
+}
+
+DeferrableDeletion *DeferredDeleter::takeDeletionsGroup() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (pendingGroups.empty()) {
+        // Take all queued items at once and split them by partition key, so each group can be released by a different worker
+        std::map<uint32_t, IDList<DeferrableDeletion, false>> groups;
+        auto deletions = queue.detachNodes();
+        while (deletions) {
+            auto deletion = deletions;
+            deletions = deletion->slice();
+            groups[deletion->getPartitionKey()].pushTailOne(*deletion);
+        }
+        for (auto &group : groups) {
+            pendingGroups.push_back(group.second.detachNodes());
         }
-    } while (!queue.peekIsEmpty());
+    }
+    if (pendingGroups.empty()) {
+        return nullptr;
+    }
+    auto group = pendingGroups.front();
+    pendingGroups.pop_front();
+    if (!pendingGroups.empty()) {
+        condition.notify_one();
+    }
+    return group;
+}
+
+void DeferredDeleter::releaseDeletionsGroup(DeferrableDeletion *deletions, IDList<DeferrableDeletion, false> &notReleased) {
+    // Each command stream receiver is waited on once per group
+    std::vector<CommandStreamReceiver *> flushedCsrs;
+    while (deletions) {
+        std::unique_ptr<DeferrableDeletion> deletion(deletions);
+        deletions = deletion->slice();
+        auto deletionSize = deletion->getSize();
+        if (deletion->applyInBatch(flushedCsrs)) {
+            deferredSize -= deletionSize;
+            elementsToRelease--;
+        } else {
+            notReleased.pushTailOne(*deletion.release());
+        }
+    }
 }
 } // namespace NEO
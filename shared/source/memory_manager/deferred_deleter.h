@@ -9,9 +9,12 @@
 #include "shared/source/utilities/idlist.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace NEO {
 class DeferrableDeletion;
@@ -32,21 +35,35 @@ class DeferredDeleter {
 
     MOCKABLE_VIRTUAL void drain(bool blocking);
 
+    size_t getDeferredSize() const { return deferredSize; }
+    size_t getPeakDeferredSize() const { return peakDeferredSize; }
+
   protected:
     void stop();
     void safeStop();
     void ensureThread();
     MOCKABLE_VIRTUAL void clearQueue();
+    bool releaseDeletions(IDList<DeferrableDeletion, false> &notReleased);
+    DeferrableDeletion *takeDeletionsGroup();
+    void releaseDeletionsGroup(DeferrableDeletion *deletions, IDList<DeferrableDeletion, false> &notReleased);
     MOCKABLE_VIRTUAL bool areElementsReleased();
     MOCKABLE_VIRTUAL bool shouldStop();
 
     static void *run(void *);
 
+    static constexpr std::chrono::microseconds minReleaseBackoff{10};
+    static constexpr std::chrono::microseconds maxReleaseBackoff{1000};
+
     std::atomic<bool> doWorkInBackground;
     std::atomic<int> elementsToRelease;
     std::unique_ptr<Thread> worker;
+    std::vector<std::unique_ptr<Thread>> additionalWorkers;
+    uint32_t startedWorkers = 0u;
+    std::atomic<size_t> deferredSize{0u};
+    std::atomic<size_t> peakDeferredSize{0u};
     int32_t numClients = 0;
     IDList<DeferrableDeletion, true> queue;
+    std::deque<DeferrableDeletion *> pendingGroups;
     std::mutex queueMutex;
     std::mutex threadMutex;
     std::condition_variable condition;
@@ -7,11 +7,14 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/cpu_info.h"
 
+#include <thread>
+
 namespace NEO {
 
 const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY,
@@ -38,6 +41,7 @@ GfxPartition::~GfxPartition() {
 void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment) {
     this->base = base;
     this->size = size;
+    this->allocationAlignment = allocationAlignment;
 
     auto heapGranularity = GfxPartition::heapGranularity;
     if (allocationAlignment > heapGranularity) {
@@ -79,6 +83,105 @@ void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
     alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
 }
 
+void GfxPartition::Heap::initMagazines(size_t magazineSize) {
+    this->magazineSize = magazineSize;
+    for (auto &magazine : magazines) {
+        std::lock_guard<std::mutex> lock(magazine.mtx);
+        magazine.ranges.clear();
+    }
+}
+
+GfxPartition::Heap::Magazine &GfxPartition::Heap::getMagazine() {
+    return magazines[std::hash<std::thread::id>{}(std::this_thread::get_id()) % magazinesCount];
+}
+
+bool GfxPartition::Heap::isMagazineSize(size_t size) const {
+    return magazineSize > 0 && size > 0 && size <= maxMagazineAllocationSize && isAligned(size, allocationAlignment);
+}
+
+uint64_t GfxPartition::Heap::allocate(size_t &size) {
+    auto alignedSize = alignUp(size, allocationAlignment);
+    if (!isMagazineSize(alignedSize)) {
+        return allocateWithCustomAlignment(size, 0u);
+    }
+
+    {
+        auto &magazine = getMagazine();
+        std::lock_guard<std::mutex> lock(magazine.mtx);
+        auto &ranges = magazine.ranges[alignedSize];
+        if (ranges.empty()) {
+            refillMagazine(ranges, alignedSize);
+        }
+        if (!ranges.empty()) {
+            auto ptr = ranges.back();
+            ranges.pop_back();
+            size = alignedSize;
+            return ptr;
+        }
+    }
+
+    // heap is exhausted, give back ranges cached by other threads before failing
+    drainMagazines();
+    return alloc->allocate(size);
+}
+
+uint64_t GfxPartition::Heap::allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) {
+    auto ptr = alloc->allocateWithCustomAlignment(sizeToAllocate, alignment);
+    if (ptr == 0llu && magazineSize > 0) {
+        // space cached in magazines may be what this allocation is missing
+        drainMagazines();
+        ptr = alloc->allocateWithCustomAlignment(sizeToAllocate, alignment);
+    }
+    return ptr;
+}
+
+void GfxPartition::Heap::refillMagazine(std::vector<uint64_t> &ranges, size_t size) {
+    size_t rangesCount = std::max(size_t{1u}, std::min(magazineSize / 2, maxMagazineRefillSize / size));
+    size_t batchSize = rangesCount * size;
+    auto batch = alloc->allocate(batchSize);
+    if (batch == 0llu) {
+        return;
+    }
+    if (batchSize > rangesCount * size) {
+        alloc->free(batch + rangesCount * size, batchSize - rangesCount * size);
+    }
+    for (size_t i = rangesCount; i > 0; i--) {
+        ranges.push_back(batch + (i - 1) * size);
+    }
+}
+
+void GfxPartition::Heap::drainMagazines() {
+    for (auto &magazine : magazines) {
+        std::lock_guard<std::mutex> lock(magazine.mtx);
+        for (auto &sizeRanges : magazine.ranges) {
+            for (auto ptr : sizeRanges.second) {
+                alloc->free(ptr, sizeRanges.first);
+            }
+        }
+        magazine.ranges.clear();
+    }
+}
+
+void GfxPartition::Heap::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu || !isMagazineSize(size)) {
+        alloc->free(ptr, size);
+        return;
+    }
+
+    auto &magazine = getMagazine();
+    std::lock_guard<std::mutex> lock(magazine.mtx);
+    auto &ranges = magazine.ranges[size];
+    ranges.push_back(ptr);
+    if (ranges.size() > magazineSize) {
+        // return older half of the magazine to the shared heap
+        auto rangesToReturn = ranges.size() / 2;
+        for (size_t i = 0; i < rangesToReturn; i++) {
+            alloc->free(ranges[i], size);
+        }
+        ranges.erase(ranges.begin(), ranges.begin() + rangesToReturn);
+    }
+}
+
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     for (auto heapName : GfxPartition::heapNonSvmNames) {
         auto &heap = getHeap(heapName);
@@ -214,6 +317,10 @@ bool GfxPartition::init(uint64_t gpuAddressSpace, size_t cpuAddressRangeSizeToRe
     heapInitWithAllocationAlignment(HeapIndex::HEAP_STANDARD2MB, gfxBase + rootDeviceIndex * gfxStandard2MBSize, gfxStandard2MBSize, 2 * MemoryConstants::megaByte);
     DEBUG_BREAK_IF(!isAligned<GfxPartition::heapGranularity2MB>(getHeapBase(HeapIndex::HEAP_STANDARD2MB)));
 
+    auto magazineSize = static_cast<size_t>(std::max(DebugManager.flags.GpuVaMagazineSize.get(), 0));
+    getHeap(HeapIndex::HEAP_STANDARD).initMagazines(magazineSize);
+    getHeap(HeapIndex::HEAP_STANDARD64KB).initMagazines(magazineSize);
+
     return true;
 }
 
@@ -13,6 +13,9 @@
 
 #include <array>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 
@@ -132,12 +135,31 @@ class GfxPartition {
         uint64_t getBase() const { return base; }
         uint64_t getSize() const { return size; }
         uint64_t getLimit() const { return size ? base + size - 1 : 0; }
-        uint64_t allocate(size_t &size) { return alloc->allocate(size); }
-        uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment) { return alloc->allocateWithCustomAlignment(sizeToAllocate, alignment); }
-        void free(uint64_t ptr, size_t size) { alloc->free(ptr, size); }
+        uint64_t allocate(size_t &size);
+        uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
+        void free(uint64_t ptr, size_t size);
+        void initMagazines(size_t magazineSize);
+
+        static constexpr size_t magazinesCount = 8u;
+        static constexpr size_t maxMagazineAllocationSize = 16 * MemoryConstants::pageSize64k;
+        // refill batches stay below allocator threshold for big chunks, so cached ranges can be freed one by one
+        static constexpr size_t maxMagazineRefillSize = 4 * MemoryConstants::megaByte;
 
       protected:
+        struct Magazine {
+            std::mutex mtx;
+            std::unordered_map<size_t, std::vector<uint64_t>> ranges;
+        };
+
+        Magazine &getMagazine();
+        bool isMagazineSize(size_t size) const;
+        void refillMagazine(std::vector<uint64_t> &ranges, size_t size);
+        void drainMagazines();
+
         uint64_t base = 0, size = 0;
+        size_t allocationAlignment = MemoryConstants::pageSize;
+        size_t magazineSize = 0u;
+        std::array<Magazine, magazinesCount> magazines;
         std::unique_ptr<HeapAllocator> alloc;
     };
 
@@ -7,16 +7,19 @@
 
 #include "shared/source/memory_manager/host_ptr_manager.h"
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
-HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
+HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrFragmentsContainer &partialAllocations, HostPtrEntryKey key) {
     auto nextElement = partialAllocations.lower_bound(key);
     auto element = nextElement;
     if (element != partialAllocations.end()) {
 
-        auto &storedFragment = element->second;
+        auto &storedFragment = *element->second;
         if (element->first.rootDeviceIndex == key.rootDeviceIndex && storedFragment.fragmentCpuPointer == key.ptr) {
             return element;
         }
@@ -26,7 +29,7 @@ HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey
         if (element->first.rootDeviceIndex != key.rootDeviceIndex) {
             return partialAllocations.end();
         }
-        auto &storedFragment = element->second;
+        auto &storedFragment = *element->second;
         auto storedEndAddress = reinterpret_cast<uintptr_t>(storedFragment.fragmentCpuPointer) + storedFragment.fragmentSize;
         if (storedFragment.fragmentSize == 0) {
             storedEndAddress++;
@@ -120,14 +123,30 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
 }
 
 void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
-    auto element = findElement(key);
-    if (element != partialAllocations.end()) {
-        element->second.refCount++;
-    } else {
-        fragment.refCount++;
-        partialAllocations.insert(std::pair<HostPtrEntryKey, FragmentStorage>(key, fragment));
+    auto shardsMask = getShardsMask(fragment.fragmentCpuPointer, fragment.fragmentSize);
+    while (true) {
+        auto lock = lockShards(shardsMask);
+        HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
+        auto &partialAllocations = shards[getShardIndex(fragment.fragmentCpuPointer)].partialAllocations;
+        auto element = findElement(partialAllocations, key);
+        if (element != partialAllocations.end()) {
+            auto &storedFragment = *element->second;
+            auto requiredShardsMask = shardsMask | getShardsMask(storedFragment.fragmentCpuPointer, storedFragment.fragmentSize);
+            if (requiredShardsMask != shardsMask) {
+                shardsMask = requiredShardsMask;
+                continue;
+            }
+            storedFragment.refCount++;
+        } else {
+            fragment.refCount++;
+            auto storedFragment = std::make_shared<FragmentStorage>(fragment);
+            for (uint32_t i = 0; i < shardsCount; i++) {
+                if (shardsMask & (1u << i)) {
+                    shards[i].partialAllocations.insert({key, storedFragment});
+                }
+            }
+        }
+        return;
     }
 }
 
@@ -140,8 +159,36 @@ void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, AllocationStorageDa
     storeFragment(rootDeviceIndex, fragment);
 }
 
-std::unique_lock<std::recursive_mutex> HostPtrManager::obtainOwnership() {
-    return std::unique_lock<std::recursive_mutex>(allocationsMutex);
+HostPtrManager::OwnershipLock HostPtrManager::obtainOwnership() {
+    return lockShards(allShardsMask);
+}
+
+uint32_t HostPtrManager::getShardIndex(const void *ptr) {
+    return static_cast<uint32_t>((castToUint64(ptr) / shardRegionSize) % shardsCount);
+}
+
+HostPtrManager::ShardsMask HostPtrManager::getShardsMask(const void *ptr, size_t size) {
+    auto firstRegion = castToUint64(ptr) / shardRegionSize;
+    auto lastRegion = (castToUint64(ptr) + std::max(size, static_cast<size_t>(1u)) - 1) / shardRegionSize;
+    if (lastRegion - firstRegion + 1 >= shardsCount) {
+        return allShardsMask;
+    }
+    ShardsMask shardsMask = 0u;
+    for (auto region = firstRegion; region <= lastRegion; region++) {
+        shardsMask |= 1u << (region % shardsCount);
+    }
+    return shardsMask;
+}
+
+HostPtrManager::OwnershipLock HostPtrManager::lockShards(ShardsMask shardsMask) {
+    // shards are always taken in index order
+    OwnershipLock ownershipLock;
+    for (uint32_t i = 0; i < shardsCount; i++) {
+        if (shardsMask & (1u << i)) {
+            ownershipLock[i] = std::unique_lock<std::recursive_mutex>(shards[i].allocationsMutex);
+        }
+    }
+    return ownershipLock;
 }
 
 void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStorage &fragments) {
@@ -153,109 +200,125 @@ void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStor
 }
 
 bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    bool fragmentReadyToBeReleased = false;
-
-    auto element = findElement({ptr, rootDeviceIndex});
-
-    DEBUG_BREAK_IF(element == partialAllocations.end());
+    ShardsMask shardsMask = 1u << getShardIndex(ptr);
+    while (true) {
+        auto lock = lockShards(shardsMask);
+        auto &partialAllocations = shards[getShardIndex(ptr)].partialAllocations;
+        auto element = findElement(partialAllocations, {ptr, rootDeviceIndex});
+
+        DEBUG_BREAK_IF(element == partialAllocations.end());
+
+        auto &fragment = *element->second;
+        auto fragmentShardsMask = getShardsMask(fragment.fragmentCpuPointer, fragment.fragmentSize);
+        if ((shardsMask | fragmentShardsMask) != shardsMask) {
+            shardsMask |= fragmentShardsMask;
+            continue;
+        }
 
-    element->second.refCount--;
-    if (element->second.refCount <= 0) {
-        fragmentReadyToBeReleased = true;
-        partialAllocations.erase(element);
+        fragment.refCount--;
+        if (fragment.refCount > 0) {
+            return false;
+        }
+        auto key = element->first;
+        for (uint32_t i = 0; i < shardsCount; i++) {
+            if (fragmentShardsMask & (1u << i)) {
+                shards[i].partialAllocations.erase(key);
+            }
+        }
+        return true;
     }
-
-    return fragmentReadyToBeReleased;
 }
 
 FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    auto element = findElement(key);
-    if (element != partialAllocations.end()) {
-        return &element->second;
+    auto &shard = shards[getShardIndex(key.ptr)];
+    std::lock_guard<std::recursive_mutex> lock(shard.allocationsMutex);
+    auto element = findElement(shard.partialAllocations, key);
+    if (element != shard.partialAllocations.end()) {
+        return element->second.get();
     }
     return nullptr;
 }
 
 //for given inputs see if any allocation overlaps
 FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    void *inputPtr = const_cast<void *>(inPtr);
-    auto nextElement = partialAllocations.lower_bound({inputPtr, rootDeviceIndex});
-    auto element = nextElement;
+    auto shardsMask = getShardsMask(inPtr, size);
+    auto lock = lockShards(shardsMask);
     overlappingStatus = OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER;
+    auto inputEndAddress = castToUint64(inPtr) + size;
 
-    if (element != partialAllocations.begin()) {
-        element--;
-    }
-
+    // fragment starting at or covering inputPtr is in the shard of its region
+    auto &partialAllocations = shards[getShardIndex(inPtr)].partialAllocations;
+    auto element = findElement(partialAllocations, {inPtr, rootDeviceIndex});
     if (element != partialAllocations.end()) {
-        if (element->first.rootDeviceIndex != rootDeviceIndex) {
-            return nullptr;
-        }
-        auto &storedFragment = element->second;
-        if (storedFragment.fragmentCpuPointer == inputPtr && storedFragment.fragmentSize == size) {
+        auto &storedFragment = *element->second;
+        auto storedEndAddress = castToUint64(storedFragment.fragmentCpuPointer) + storedFragment.fragmentSize;
+        if (storedFragment.fragmentCpuPointer == inPtr && storedFragment.fragmentSize == size) {
             overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
-            return &element->second;
+        } else if (inputEndAddress <= storedEndAddress) {
+            overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
+        } else {
+            overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
+            return nullptr;
         }
+        return &storedFragment;
+    }
 
-        auto storedEndAddress = (uintptr_t)storedFragment.fragmentCpuPointer + storedFragment.fragmentSize;
-        auto inputEndAddress = (uintptr_t)inputPtr + size;
-
-        if (inputPtr >= storedFragment.fragmentCpuPointer && (uintptr_t)inputPtr < (uintptr_t)storedEndAddress) {
-            if (inputEndAddress <= storedEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                return &element->second;
-            } else {
+    // any fragment starting inside the input range is bigger overlap, it is stored in the shard of its start region
+    for (uint32_t i = 0; i < shardsCount; i++) {
+        if (shardsMask & (1u << i)) {
+            auto nextElement = shards[i].partialAllocations.upper_bound({inPtr, rootDeviceIndex});
+            if (nextElement != shards[i].partialAllocations.end() && nextElement->first.rootDeviceIndex == rootDeviceIndex &&
+                castToUint64(nextElement->first.ptr) < inputEndAddress) {
                 overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
                 return nullptr;
             }
         }
-        //next fragment doesn't have to be after the inputPtr
-        if (nextElement != partialAllocations.end()) {
-            if (nextElement->first.rootDeviceIndex != rootDeviceIndex) {
-                return nullptr;
-            }
-            auto &storedNextElement = nextElement->second;
-            auto storedNextEndAddress = (uintptr_t)storedNextElement.fragmentCpuPointer + storedNextElement.fragmentSize;
-            auto storedNextStartAddress = (uintptr_t)storedNextElement.fragmentCpuPointer;
-            //check if this allocation is after the inputPtr
-            if ((uintptr_t)inputPtr < storedNextStartAddress) {
-                if (inputEndAddress > storedNextStartAddress) {
-                    overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                    return nullptr;
-                }
-            } else if (inputEndAddress > storedNextEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                return nullptr;
-            } else {
-                DEBUG_BREAK_IF((uintptr_t)inputPtr != storedNextStartAddress);
-                if (inputEndAddress < storedNextEndAddress) {
-                    overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                } else {
-                    DEBUG_BREAK_IF(inputEndAddress != storedNextEndAddress);
-                    overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
-                }
-                return &nextElement->second;
-            }
-        }
     }
     return nullptr;
 }
 
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
     auto requirements = HostPtrManager::getAllocationRequirements(rootDeviceIndex, ptr, size);
-    UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
-    auto osStorage = populateAlreadyAllocatedFragments(requirements);
-    if (osStorage.fragmentCount > 0) {
-        if (memoryManager.populateOsHandles(osStorage, rootDeviceIndex) != MemoryManager::AllocationStatus::Success) {
-            memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
-            osStorage.fragmentCount = 0;
+    auto shardsMask = getShardsMask(requirements.allocationFragments[0].allocationPtr, requirements.totalRequiredSize);
+    while (true) {
+        auto lock = lockShards(shardsMask);
+        // reused fragments may reach regions outside of the requested range, their shards have to be held as well
+        auto requiredShardsMask = shardsMask;
+        bool biggerOverlapFound = false;
+        for (unsigned int i = 0; i < requirements.requiredFragmentsCount; i++) {
+            OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+            auto storedFragment = getFragmentAndCheckForOverlaps(rootDeviceIndex, requirements.allocationFragments[i].allocationPtr,
+                                                                 requirements.allocationFragments[i].allocationSize, overlapStatus);
+            if (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT) {
+                biggerOverlapFound = true;
+            } else if (storedFragment != nullptr) {
+                requiredShardsMask |= getShardsMask(storedFragment->fragmentCpuPointer, storedFragment->fragmentSize);
+            }
+        }
+        if (biggerOverlapFound) {
+            // cleaning temporary allocations takes ownership of all shards, so no shard can be held here
+            for (auto &shardLock : lock) {
+                if (shardLock.owns_lock()) {
+                    shardLock.unlock();
+                }
+            }
+            UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
+            continue;
+        }
+        if (requiredShardsMask != shardsMask) {
+            shardsMask = requiredShardsMask;
+            continue;
+        }
+
+        auto osStorage = populateAlreadyAllocatedFragments(requirements);
+        if (osStorage.fragmentCount > 0) {
+            if (memoryManager.populateOsHandles(osStorage, rootDeviceIndex) != MemoryManager::AllocationStatus::Success) {
+                memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
+                osStorage.fragmentCount = 0;
+            }
         }
+        return osStorage;
     }
-    return osStorage;
 }
 
 RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements) {
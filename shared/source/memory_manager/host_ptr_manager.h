@@ -6,9 +6,12 @@
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/host_ptr_defines.h"
 
+#include <array>
 #include <map>
+#include <memory>
 #include <mutex>
 
 namespace NEO {
@@ -23,26 +26,41 @@ struct HostPtrEntryKey {
     }
 };
 
-using HostPtrFragmentsContainer = std::map<HostPtrEntryKey, FragmentStorage>;
+// fragments spanning several address regions are shared by the shards of all these regions
+using HostPtrFragmentsContainer = std::map<HostPtrEntryKey, std::shared_ptr<FragmentStorage>>;
 class MemoryManager;
 class HostPtrManager {
   public:
+    static constexpr uint32_t shardsCount = 8u;
+    static constexpr size_t shardRegionSize = MemoryConstants::pageSize2Mb;
+    using OwnershipLock = std::array<std::unique_lock<std::recursive_mutex>, shardsCount>;
+
     FragmentStorage *getFragment(HostPtrEntryKey key);
     OsHandleStorage prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex);
     void releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStorage &fragments);
     bool releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr);
     void storeFragment(uint32_t rootDeviceIndex, AllocationStorageData &storageData);
     void storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment);
-    std::unique_lock<std::recursive_mutex> obtainOwnership();
+    OwnershipLock obtainOwnership();
 
   protected:
+    using ShardsMask = uint32_t;
+    static constexpr ShardsMask allShardsMask = (1u << shardsCount) - 1;
+
+    struct FragmentsShard {
+        HostPtrFragmentsContainer partialAllocations;
+        std::recursive_mutex allocationsMutex;
+    };
+
     static AllocationRequirements getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size);
     OsHandleStorage populateAlreadyAllocatedFragments(AllocationRequirements &requirements);
     FragmentStorage *getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
 
-    HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
-    HostPtrFragmentsContainer partialAllocations;
-    std::recursive_mutex allocationsMutex;
+    static uint32_t getShardIndex(const void *ptr);
+    static ShardsMask getShardsMask(const void *ptr, size_t size);
+    OwnershipLock lockShards(ShardsMask shardsMask);
+    HostPtrFragmentsContainer::iterator findElement(HostPtrFragmentsContainer &partialAllocations, HostPtrEntryKey key);
+    std::array<FragmentsShard, shardsCount> shards;
 };
 } // namespace NEO
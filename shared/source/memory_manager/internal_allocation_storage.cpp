@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,24 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
     auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
     allocationsList.pushTailOne(*gfxAllocation.release());
+
+    if (allocationUsage == REUSABLE_ALLOCATION) {
+        trimAllocationsForReuse();
+    }
+}
+
+void InternalAllocationStorage::trimAllocationsForReuse() {
+    auto sizeLimit = DebugManager.flags.ReusableAllocationsCacheSizeLimit.get();
+    if (sizeLimit < 0) {
+        return;
+    }
+    while (allocationsForReuse.getTotalSize() > static_cast<size_t>(sizeLimit)) {
+        auto allocation = allocationsForReuse.detachOldestCompletedAllocation(commandStreamReceiver);
+        if (!allocation) {
+            break;
+        }
+        commandStreamReceiver.getMemoryManager()->freeGraphicsMemory(allocation.release());
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
@@ -47,22 +65,12 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
     auto memoryManager = commandStreamReceiver.getMemoryManager();
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
-    GraphicsAllocation *curr = allocationsList.detachNodes();
-
-    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    GraphicsAllocation *curr = allocationsList.detachCompletedAllocations(waitTaskCount, commandStreamReceiver.getOsContext().getContextId());
     while (curr != nullptr) {
         auto *next = curr->next;
-        if (curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
-            memoryManager->freeGraphicsMemory(curr);
-        } else {
-            allocationsLeft.pushTailOne(*curr);
-        }
+        memoryManager->freeGraphicsMemory(curr);
         curr = next;
     }
-
-    if (allocationsLeft.peekIsEmpty() == false) {
-        allocationsList.splice(*allocationsLeft.detachNodes());
-    }
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
@@ -98,25 +106,117 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
     return std::unique_ptr<GraphicsAllocation>(retAlloc);
 }
 
+std::unique_ptr<GraphicsAllocation> AllocationsList::detachOldestCompletedAllocation(CommandStreamReceiver &commandStreamReceiver) {
+    ReusableAllocationRequirements req = {};
+    req.csrTagAddress = commandStreamReceiver.getTagAddress();
+    req.contextId = commandStreamReceiver.getOsContext().getContextId();
+    GraphicsAllocation *a = nullptr;
+    GraphicsAllocation *retAlloc = processLocked<AllocationsList, &AllocationsList::detachOldestCompletedAllocationImpl>(a, static_cast<void *>(&req));
+    return std::unique_ptr<GraphicsAllocation>(retAlloc);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &allocation) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneAndIndexImpl>(&allocation);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesAndIndexImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &allocations) {
+    processLocked<AllocationsList, &AllocationsList::spliceAndIndexImpl>(&allocations);
+}
+
+GraphicsAllocation *AllocationsList::detachCompletedAllocations(uint32_t completedTaskCount, uint32_t contextId) {
+    ReusableAllocationRequirements req = {};
+    req.csrTagAddress = &completedTaskCount;
+    req.contextId = contextId;
+    return processLocked<AllocationsList, &AllocationsList::detachCompletedAllocationsImpl>(nullptr, static_cast<void *>(&req));
+}
+
 GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (this->allocationUsage == TEMPORARY_ALLOCATION || *req->csrTagAddress >= curr->getTaskCount(req->contextId)) &&
+    // allocations of given type are ordered by size, so the first matching one is the best fit
+    auto it = allocationsIndex.lower_bound({req->allocationType, req->requiredMinimalSize});
+    for (; it != allocationsIndex.end() && it->first.first == req->allocationType; it++) {
+        auto *curr = it->second;
+        if ((this->allocationUsage == TEMPORARY_ALLOCATION || *req->csrTagAddress >= curr->getTaskCount(req->contextId)) &&
             (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
             if (this->allocationUsage == TEMPORARY_ALLOCATION) {
                 // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
                 curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
             }
-            return removeOneImpl(curr, nullptr);
+            return removeIndexedImpl(it);
         }
-        curr = curr->next;
     }
     return nullptr;
 }
 
+GraphicsAllocation *AllocationsList::detachOldestCompletedAllocationImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+    for (auto *curr = head; curr != nullptr; curr = curr->next) {
+        if (*req->csrTagAddress >= curr->getTaskCount(req->contextId)) {
+            return removeFromIndexImpl(*curr);
+        }
+    }
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::detachCompletedAllocationsImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+    IDList<GraphicsAllocation, false, false> completed;
+    auto *curr = head;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        if (*req->csrTagAddress >= curr->getTaskCount(req->contextId)) {
+            completed.pushTailOne(*removeFromIndexImpl(*curr));
+        }
+        curr = next;
+    }
+    return completed.detachNodes();
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneAndIndexImpl(GraphicsAllocation *allocation, void *) {
+    addToIndex(*allocation);
+    return pushTailOneImpl(allocation, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachNodesAndIndexImpl(GraphicsAllocation *, void *) {
+    allocationsIndex.clear();
+    totalSize = 0u;
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceAndIndexImpl(GraphicsAllocation *allocations, void *) {
+    for (auto *curr = allocations; curr != nullptr; curr = curr->next) {
+        addToIndex(*curr);
+    }
+    return spliceImpl(allocations, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeIndexedImpl(AllocationsIndex::iterator it) {
+    auto *allocation = it->second;
+    totalSize -= allocation->getUnderlyingBufferSize();
+    allocationsIndex.erase(it);
+    return removeOneImpl(allocation, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFromIndexImpl(GraphicsAllocation &allocation) {
+    auto range = allocationsIndex.equal_range({allocation.getAllocationType(), allocation.getUnderlyingBufferSize()});
+    for (auto it = range.first; it != range.second; it++) {
+        if (it->second == &allocation) {
+            return removeIndexedImpl(it);
+        }
+    }
+    UNRECOVERABLE_IF(true);
+    return nullptr;
+}
+
+void AllocationsList::addToIndex(GraphicsAllocation &allocation) {
+    allocationsIndex.insert({{allocation.getAllocationType(), allocation.getUnderlyingBufferSize()}, &allocation});
+    totalSize += allocation.getUnderlyingBufferSize();
+}
+
 DeviceBitfield InternalAllocationStorage::getDeviceBitfield() const {
     return commandStreamReceiver.getOsContext().getDeviceBitfield();
 }
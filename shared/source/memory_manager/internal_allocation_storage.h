@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@ class InternalAllocationStorage {
 
   protected:
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    void trimAllocationsForReuse();
     CommandStreamReceiver &commandStreamReceiver;
 
     AllocationsList temporaryAllocations;
@@ -80,11 +80,15 @@ class DrmAllocation : public GraphicsAllocation {
     void linkWithRegisteredHandle(uint32_t handle);
     MOCKABLE_VIRTUAL void markForCapture();
 
+    bool isUserptrCacheable() const { return userptrCacheable; }
+    void setUserptrCacheable(bool cacheable) { userptrCacheable = cacheable; }
+
   protected:
     BufferObjects bufferObjects{};
     StackVec<uint32_t, 1> registeredBoBindHandles;
 
     void *mmapPtr = nullptr;
     size_t mmapSize = 0u;
+    bool userptrCacheable = false;
 };
 } // namespace NEO
@@ -48,6 +48,9 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
         const auto heapIndex = customAlignment >= MemoryConstants::pageSize2Mb ? HeapIndex::HEAP_STANDARD2MB : HeapIndex::HEAP_STANDARD64KB;
         alignmentSelector.addCandidateAlignment(customAlignment, true, AlignmentSelector::anyWastage, heapIndex);
     }
+    if (DebugManager.flags.UserptrCacheSize.get() > 0) {
+        userptrCacheCapacity = static_cast<size_t>(DebugManager.flags.UserptrCacheSize.get());
+    }
 
     initialize(mode);
 }
@@ -120,6 +123,11 @@ void DrmMemoryManager::commonCleanup() {
         gemCloseWorker->close(false);
     }
 
+    for (auto &entry : userptrCache) {
+        releaseUserptrCacheEntry(entry);
+    }
+    userptrCache.clear();
+
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < pinBBs.size(); ++rootDeviceIndex) {
         if (auto bo = pinBBs[rootDeviceIndex]) {
             if (isLimitedRange(rootDeviceIndex)) {
@@ -175,6 +183,57 @@ uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDe
     return r;
 }
 
+BufferObject *DrmMemoryManager::takeUserptrFromCache(uintptr_t address, size_t &size, uint32_t rootDeviceIndex) {
+    if (userptrCacheCapacity == 0) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(userptrCacheMutex);
+    for (auto it = userptrCache.begin(); it != userptrCache.end(); it++) {
+        if (it->address != address || it->bo->peekSize() != size || it->rootDeviceIndex != rootDeviceIndex) {
+            continue;
+        }
+        auto entry = *it;
+        userptrCache.erase(it);
+        lock.unlock();
+
+        // registration of unmapped host memory cannot be reused
+        if (this->msyncFunction(reinterpret_cast<void *>(address), size, MS_ASYNC) != 0) {
+            releaseUserptrCacheEntry(entry);
+            return nullptr;
+        }
+        size = entry.size;
+        return entry.bo;
+    }
+    return nullptr;
+}
+
+bool DrmMemoryManager::storeUserptrInCache(DrmAllocation &allocation) {
+    auto bo = allocation.getBO();
+    if (userptrCacheCapacity == 0 || !allocation.isUserptrCacheable() || bo->getRefCount() != 1) {
+        return false;
+    }
+    UserptrCacheEntry entry{bo, reinterpret_cast<uintptr_t>(alignDown(allocation.getUnderlyingBuffer(), MemoryConstants::pageSize)),
+                            allocation.getReservedAddressSize(), allocation.getRootDeviceIndex()};
+
+    std::unique_lock<std::mutex> lock(userptrCacheMutex);
+    userptrCache.push_front(entry);
+    if (userptrCache.size() <= userptrCacheCapacity) {
+        return true;
+    }
+    auto leastRecentlyUsed = userptrCache.back();
+    userptrCache.pop_back();
+    lock.unlock();
+
+    releaseUserptrCacheEntry(leastRecentlyUsed);
+    return true;
+}
+
+void DrmMemoryManager::releaseUserptrCacheEntry(const UserptrCacheEntry &entry) {
+    auto gpuAddress = entry.bo->peekAddress();
+    unreference(entry.bo, true);
+    releaseGpuRange(reinterpret_cast<void *>(gpuAddress), entry.size, entry.rootDeviceIndex);
+}
+
 uint64_t DrmMemoryManager::acquireGpuRange(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex) {
     auto gfxPartition = getGfxPartition(rootDeviceIndex);
     return GmmHelper::canonize(gfxPartition->heapAllocate(heapIndex, size));
@@ -415,19 +474,25 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryForNonSvmHostPtr(const Al
     auto offsetInPage = ptrDiff(allocationData.hostPtr, alignedPtr);
     auto rootDeviceIndex = allocationData.rootDeviceIndex;
 
-    auto gpuVirtualAddress = acquireGpuRange(alignedSize, rootDeviceIndex, HeapIndex::HEAP_STANDARD);
-    if (!gpuVirtualAddress) {
-        return nullptr;
-    }
+    std::unique_ptr<BufferObject, BufferObject::Deleter> bo(takeUserptrFromCache(reinterpret_cast<uintptr_t>(alignedPtr), alignedSize, rootDeviceIndex));
+    uint64_t gpuVirtualAddress = bo ? bo->peekAddress() : 0u;
 
-    std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(alignedPtr), realAllocationSize, 0, rootDeviceIndex));
     if (!bo) {
-        releaseGpuRange(reinterpret_cast<void *>(gpuVirtualAddress), alignedSize, rootDeviceIndex);
-        return nullptr;
-    }
+        gpuVirtualAddress = acquireGpuRange(alignedSize, rootDeviceIndex, HeapIndex::HEAP_STANDARD);
+        if (!gpuVirtualAddress) {
+            return nullptr;
+        }
 
-    bo->gpuAddress = gpuVirtualAddress;
+        bo.reset(allocUserptr(reinterpret_cast<uintptr_t>(alignedPtr), realAllocationSize, 0, rootDeviceIndex));
+        if (!bo) {
+            releaseGpuRange(reinterpret_cast<void *>(gpuVirtualAddress), alignedSize, rootDeviceIndex);
+            return nullptr;
+        }
+
+        bo->gpuAddress = gpuVirtualAddress;
+    }
 
+    // cached registrations are validated as well, host memory could have been remapped at the same address since
     if (validateHostPtrMemory) {
         auto boPtr = bo.get();
         auto vmHandleId = Math::getMinLsbSet(static_cast<uint32_t>(allocationData.storageInfo.subDeviceBitfield.to_ulong()));
@@ -442,6 +507,7 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryForNonSvmHostPtr(const Al
     auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, bo.get(), const_cast<void *>(allocationData.hostPtr),
                                         gpuVirtualAddress, allocationData.size, MemoryPool::System4KBPages);
     allocation->setAllocationOffset(offsetInPage);
+    allocation->setUserptrCacheable(true);
 
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuVirtualAddress), alignedSize);
     bo.release();
@@ -749,6 +815,9 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
 
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
+    } else if (storeUserptrInCache(*drmAlloc)) {
+        // buffer object and its gpu range are owned by the userptr cache now
+        gfxAllocation->setReservedAddressRange(nullptr, 0);
     } else {
         auto &bos = static_cast<DrmAllocation *>(gfxAllocation)->getBOs();
         for (auto bo : bos) {
@@ -14,6 +14,7 @@
 #include "drm_gem_close_worker.h"
 
 #include <limits>
+#include <list>
 #include <map>
 #include <sys/mman.h>
 
@@ -77,10 +78,20 @@ class DrmMemoryManager : public MemoryManager {
     DrmAllocation *createUSMHostAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool hasMappedPtr);
 
   protected:
+    struct UserptrCacheEntry {
+        BufferObject *bo;
+        uintptr_t address;
+        size_t size;
+        uint32_t rootDeviceIndex;
+    };
+
     BufferObject *findAndReferenceSharedBufferObject(int boHandle);
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, uint32_t rootDeviceIndex);
+    BufferObject *takeUserptrFromCache(uintptr_t address, size_t &size, uint32_t rootDeviceIndex);
+    bool storeUserptrInCache(DrmAllocation &allocation);
+    void releaseUserptrCacheEntry(const UserptrCacheEntry &entry);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
     uint64_t acquireGpuRange(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex);
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
@@ -127,9 +138,14 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&munmap) munmapFunction = munmap;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
+    decltype(&msync) msyncFunction = msync;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
 
+    std::list<UserptrCacheEntry> userptrCache;
+    std::mutex userptrCacheMutex;
+    size_t userptrCacheCapacity = 0u;
+
     std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
     std::vector<GraphicsAllocation *> sysMemAllocs;
     std::mutex allocMutex;
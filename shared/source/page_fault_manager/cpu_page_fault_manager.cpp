@@ -8,6 +8,9 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -29,8 +32,18 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     }
     const auto domain = initialPlacementCpu ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    if (const int64_t chunkSize = DebugManager.flags.UsmPageFaultMigrationChunkSize.get(); chunkSize > 0) {
+        pageFaultData.chunkSize = alignUp(static_cast<size_t>(chunkSize), MemoryConstants::pageSize);
+        if (size > pageFaultData.chunkSize && this->gpuDomainHandler == &PageFaultManager::handleGpuDomainTransferForHw) {
+            pageFaultData.cpuChunks.assign(Math::divideAndRoundUp(size, pageFaultData.chunkSize), initialPlacementCpu);
+        } else {
+            pageFaultData.chunkSize = 0;
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (!initialPlacementCpu) {
         this->setAubWritable(false, ptr, unifiedMemoryManager);
         this->protectCPUMemoryAccess(ptr, size);
@@ -42,10 +55,11 @@ void PageFaultManager::removeAllocation(void *ptr) {
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu || pageFaultData.prefetchedToCpu || (pageFaultData.chunkSize && pageFaultData.domain == AllocationDomain::Cpu)) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
-        this->memoryData.erase(ptr);
+        this->predictedAllocations.erase(ptr);
+        this->memoryData.erase(alloc);
     }
 }
 
@@ -55,50 +69,263 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
         if (pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-                    printf("UMD transferring shared allocation %llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(ptr));
-                }
-                this->transferToGpu(ptr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(ptr, pageFaultData.size);
-            }
-            pageFaultData.domain = AllocationDomain::Gpu;
+            this->migrateToGpuDomain(ptr, pageFaultData, nullptr);
+        } else {
+            this->resetCpuAccessStreak(ptr, pageFaultData);
         }
     }
 }
 
+void PageFaultManager::moveAllocationToCpuDomain(void *ptr) {
+    std::unique_lock<SpinLock> lock{mtx};
+    auto alloc = findAllocation(ptr);
+    if (alloc != memoryData.end()) {
+        this->migrateToCpuDomain(alloc->first, alloc->second);
+    }
+}
+
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
     std::unique_lock<SpinLock> lock{mtx};
+    if (DebugManager.flags.EnableBatchedUsmMigration.get() == 0) {
+        for (auto &alloc : this->memoryData) {
+            if (alloc.second.unifiedMemoryManager != unifiedMemoryManager) {
+                continue;
+            }
+            if (alloc.second.domain != AllocationDomain::Gpu) {
+                this->migrateToGpuDomain(alloc.first, alloc.second, nullptr);
+            } else {
+                this->resetCpuAccessStreak(alloc.first, alloc.second);
+            }
+        }
+        return;
+    }
+
+    std::vector<CpuMemoryRange> rangesToProtect;
+    this->batchTransfersToGpu = true;
     for (auto &alloc : this->memoryData) {
         auto allocPtr = alloc.first;
         auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                if (DebugManager.flags.PrintUmdSharedMigration.get()) {
-                    printf("UMD transferring shared allocation %llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(allocPtr));
+        if (pageFaultData.unifiedMemoryManager != unifiedMemoryManager) {
+            continue;
+        }
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
+            this->migrateToGpuDomain(allocPtr, pageFaultData, &rangesToProtect);
+        } else {
+            this->resetCpuAccessStreak(allocPtr, pageFaultData);
+        }
+    }
+    this->batchTransfersToGpu = false;
+
+    if (!rangesToProtect.empty()) {
+        this->finishTransfersToGpu();
+        this->protectCoalescedRanges(rangesToProtect);
+    }
+}
+
+void PageFaultManager::protectCoalescedRanges(std::vector<CpuMemoryRange> &ranges) {
+    // ranges come in address order from memoryData, merge the ones that touch
+    auto current = ranges[0];
+    for (size_t i = 1; i < ranges.size(); i++) {
+        if (ptrOffset(current.ptr, current.size) == ranges[i].ptr) {
+            current.size += ranges[i].size;
+        } else {
+            this->protectCPUMemoryAccess(current.ptr, current.size);
+            current = ranges[i];
+        }
+    }
+    this->protectCPUMemoryAccess(current.ptr, current.size);
+}
+
+PageFaultManager::MigrationStatistics PageFaultManager::getMigrationStatistics() {
+    std::unique_lock<SpinLock> lock{mtx};
+    return this->migrationStatistics;
+}
+
+void PageFaultManager::migrateToGpuDomain(void *allocPtr, PageFaultData &pageFaultData, std::vector<CpuMemoryRange> *rangesToProtect) {
+    this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.prefetchedToCpu) {
+        // prefetched copy was never touched by the CPU, so GPU data is still current and the prediction missed
+        pageFaultData.prefetchedToCpu = false;
+        this->discardCpuCopy(allocPtr, pageFaultData.cmdQ);
+        pageFaultData.domain = AllocationDomain::Gpu;
+        this->resetCpuAccessStreak(allocPtr, pageFaultData);
+        return;
+    }
+    if (pageFaultData.domain == AllocationDomain::Cpu) {
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferring shared allocation %llx from CPU to GPU\n", reinterpret_cast<unsigned long long int>(allocPtr));
+        }
+        if (pageFaultData.chunkSize) {
+            auto &cpuChunks = pageFaultData.cpuChunks;
+            for (size_t chunk = 0; chunk < cpuChunks.size();) {
+                if (!cpuChunks[chunk]) {
+                    chunk++;
+                    continue;
                 }
-                this->transferToGpu(allocPtr, pageFaultData.cmdQ);
+                auto firstChunk = chunk;
+                while (chunk < cpuChunks.size() && cpuChunks[chunk]) {
+                    cpuChunks[chunk++] = false;
+                }
+                auto offset = firstChunk * pageFaultData.chunkSize;
+                auto size = std::min(chunk * pageFaultData.chunkSize, pageFaultData.size) - offset;
+                this->transferChunkToGpu(allocPtr, offset, size, pageFaultData.cmdQ);
+                this->migrationStatistics.transfersToGpu++;
+                this->migrationStatistics.bytesTransferredToGpu += size;
+                if (rangesToProtect) {
+                    rangesToProtect->push_back({ptrOffset(allocPtr, offset), size});
+                } else {
+                    this->protectCPUMemoryAccess(ptrOffset(allocPtr, offset), size);
+                }
+            }
+        } else {
+            this->transferToGpu(allocPtr, pageFaultData.cmdQ);
+            this->migrationStatistics.transfersToGpu++;
+            this->migrationStatistics.bytesTransferredToGpu += pageFaultData.size;
+            if (rangesToProtect) {
+                rangesToProtect->push_back({allocPtr, pageFaultData.size});
+            } else {
                 this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
             }
-            pageFaultData.domain = AllocationDomain::Gpu;
         }
     }
+    pageFaultData.domain = AllocationDomain::Gpu;
+}
+
+std::map<void *, PageFaultManager::PageFaultData>::iterator PageFaultManager::findAllocation(void *ptr) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return this->memoryData.end();
+    }
+    --alloc;
+    if (ptr < ptrOffset(alloc->first, alloc->second.size)) {
+        return alloc;
+    }
+    return this->memoryData.end();
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
+    auto alloc = findAllocation(ptr);
+    if (alloc == this->memoryData.end()) {
+        return false;
+    }
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    this->migrationStatistics.pageFaults++;
+    if (pageFaultData.chunkSize) {
+        handleChunkPageFault(ptr, allocPtr, pageFaultData);
+    } else if (pageFaultData.prefetchedToCpu) {
+        // data is already on the CPU, the fault only confirms the prediction
+        pageFaultData.prefetchedToCpu = false;
+        this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+        this->recordCpuAccess(allocPtr, pageFaultData);
+    } else {
+        const auto previousDomain = pageFaultData.domain;
+        gpuDomainHandler(this, allocPtr, pageFaultData);
+        if (previousDomain == AllocationDomain::Gpu && pageFaultData.domain == AllocationDomain::Cpu) {
+            this->migrationStatistics.transfersToCpu++;
+            this->migrationStatistics.bytesTransferredToCpu += pageFaultData.size;
+            this->recordCpuAccess(allocPtr, pageFaultData);
+            this->prefetchPredictedAllocationsToCpu(allocPtr, pageFaultData.unifiedMemoryManager);
+        }
+    }
+    return true;
+}
+
+void PageFaultManager::recordCpuAccess(void *allocPtr, PageFaultData &pageFaultData) {
+    pageFaultData.cpuAccessStreak++;
+    const auto threshold = DebugManager.flags.UsmMigrationPredictionThreshold.get();
+    if (threshold > 0 && pageFaultData.cpuAccessStreak >= static_cast<uint32_t>(threshold)) {
+        this->predictedAllocations.insert(allocPtr);
+    }
+}
+
+void PageFaultManager::resetCpuAccessStreak(void *allocPtr, PageFaultData &pageFaultData) {
+    pageFaultData.cpuAccessStreak = 0;
+    this->predictedAllocations.erase(allocPtr);
+}
+
+void PageFaultManager::prefetchPredictedAllocationsToCpu(void *faultAllocPtr, SVMAllocsManager *unifiedMemoryManager) {
+    if (this->predictedAllocations.empty() || this->gpuDomainHandler != &PageFaultManager::handleGpuDomainTransferForHw) {
+        return;
+    }
+    // allocations touched by the CPU after each of the last GPU phases are expected to fault again,
+    // their data is copied ahead but they stay protected so the next fault shows whether the CPU really used them
+    for (auto predictedPtr : this->predictedAllocations) {
+        auto alloc = this->memoryData.find(predictedPtr);
+        UNRECOVERABLE_IF(alloc == this->memoryData.end());
+        auto &pageFaultData = alloc->second;
+        if (predictedPtr == faultAllocPtr || pageFaultData.unifiedMemoryManager != unifiedMemoryManager ||
+            pageFaultData.domain != AllocationDomain::Gpu || pageFaultData.chunkSize) {
+            continue;
+        }
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferring shared allocation %llx from GPU to CPU\n", reinterpret_cast<unsigned long long int>(predictedPtr));
         }
+        this->transferToCpu(predictedPtr, pageFaultData.size, pageFaultData.cmdQ);
+        this->migrationStatistics.transfersToCpu++;
+        this->migrationStatistics.bytesTransferredToCpu += pageFaultData.size;
+        pageFaultData.domain = AllocationDomain::Cpu;
+        pageFaultData.prefetchedToCpu = true;
     }
-    return false;
+}
+
+void PageFaultManager::migrateToCpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.prefetchedToCpu) {
+        pageFaultData.prefetchedToCpu = false;
+        this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+    }
+    if (pageFaultData.chunkSize) {
+        auto &cpuChunks = pageFaultData.cpuChunks;
+        for (size_t chunk = 0; chunk < cpuChunks.size();) {
+            if (cpuChunks[chunk]) {
+                chunk++;
+                continue;
+            }
+            auto firstChunk = chunk;
+            while (chunk < cpuChunks.size() && !cpuChunks[chunk]) {
+                cpuChunks[chunk++] = true;
+            }
+            auto offset = firstChunk * pageFaultData.chunkSize;
+            auto size = std::min(chunk * pageFaultData.chunkSize, pageFaultData.size) - offset;
+            if (pageFaultData.domain != AllocationDomain::None) {
+                this->transferChunkToCpu(allocPtr, offset, size, pageFaultData.cmdQ);
+                this->migrationStatistics.transfersToCpu++;
+                this->migrationStatistics.bytesTransferredToCpu += size;
+            }
+            this->allowCPUMemoryAccess(ptrOffset(allocPtr, offset), size);
+        }
+    } else if (pageFaultData.domain != AllocationDomain::Cpu) {
+        if (pageFaultData.domain == AllocationDomain::Gpu) {
+            if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+                printf("UMD transferring shared allocation %llx from GPU to CPU\n", reinterpret_cast<unsigned long long int>(allocPtr));
+            }
+            this->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
+            this->migrationStatistics.transfersToCpu++;
+            this->migrationStatistics.bytesTransferredToCpu += pageFaultData.size;
+        }
+        this->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+    }
+    pageFaultData.domain = AllocationDomain::Cpu;
+}
+
+void PageFaultManager::handleChunkPageFault(void *ptr, void *allocPtr, PageFaultData &pageFaultData) {
+    auto chunk = ptrDiff(ptr, allocPtr) / pageFaultData.chunkSize;
+    auto offset = chunk * pageFaultData.chunkSize;
+    auto size = std::min(pageFaultData.chunkSize, pageFaultData.size - offset);
+    if (pageFaultData.domain != AllocationDomain::None && !pageFaultData.cpuChunks[chunk]) {
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferring shared allocation %llx chunk %zu from GPU to CPU\n", reinterpret_cast<unsigned long long int>(allocPtr), chunk);
+        }
+        this->transferChunkToCpu(allocPtr, offset, size, pageFaultData.cmdQ);
+        this->migrationStatistics.transfersToCpu++;
+        this->migrationStatistics.bytesTransferredToCpu += size;
+    }
+    pageFaultData.cpuChunks[chunk] = true;
+    pageFaultData.domain = AllocationDomain::Cpu;
+    this->allowCPUMemoryAccess(ptrOffset(allocPtr, offset), size);
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
@@ -12,8 +12,10 @@
 
 #include "memory_properties_flags.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <set>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -27,6 +29,7 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual ~PageFaultManager() = default;
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
+    MOCKABLE_VIRTUAL void moveAllocationToCpuDomain(void *ptr);
     void moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager);
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties);
     void removeAllocation(void *ptr);
@@ -42,8 +45,22 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0;
+        std::vector<bool> cpuChunks;
+        uint32_t cpuAccessStreak = 0;
+        bool prefetchedToCpu = false;
     };
 
+    struct MigrationStatistics {
+        uint64_t pageFaults = 0;
+        uint64_t transfersToCpu = 0;
+        uint64_t transfersToGpu = 0;
+        uint64_t bytesTransferredToCpu = 0;
+        uint64_t bytesTransferredToGpu = 0;
+    };
+
+    MigrationStatistics getMigrationStatistics();
+
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
 
     void setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr);
@@ -51,21 +68,47 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ);
 
   protected:
+    struct CpuMemoryRange {
+        void *ptr;
+        size_t size;
+    };
+
+    struct PendingTransfer {
+        void *allocPtr;
+        void *cmdQ;
+    };
+
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferChunkToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void finishTransfersToGpu();
+    MOCKABLE_VIRTUAL void discardCpuCopy(void *ptr, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     static void handleGpuDomainTransferForAubAndTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
     void selectGpuDomainHandler();
+    void migrateToGpuDomain(void *allocPtr, PageFaultData &pageFaultData, std::vector<CpuMemoryRange> *rangesToProtect);
+    void protectCoalescedRanges(std::vector<CpuMemoryRange> &ranges);
+    void migrateToCpuDomain(void *allocPtr, PageFaultData &pageFaultData);
+    void prefetchPredictedAllocationsToCpu(void *faultAllocPtr, SVMAllocsManager *unifiedMemoryManager);
+    void recordCpuAccess(void *allocPtr, PageFaultData &pageFaultData);
+    void resetCpuAccessStreak(void *allocPtr, PageFaultData &pageFaultData);
+    void handleChunkPageFault(void *ptr, void *allocPtr, PageFaultData &pageFaultData);
+    std::map<void *, PageFaultData>::iterator findAllocation(void *ptr);
 
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    std::map<void *, PageFaultData> memoryData;
+    std::set<void *> predictedAllocations;
+    std::vector<PendingTransfer> pendingTransfersToGpu;
+    MigrationStatistics migrationStatistics;
+    bool batchTransfersToGpu = false;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -51,6 +51,10 @@ void populateProgramInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPa
         populateSingleKernelInfo(dst, src, i);
     }
 
+    populateProgramScopeInfo(dst, src);
+}
+
+void populateProgramScopeInfo(ProgramInfo &dst, const PatchTokenBinary::ProgramFromPatchtokens &src) {
     if (src.programScopeTokens.allocateConstantMemorySurface.empty() == false) {
         auto surface = src.programScopeTokens.allocateConstantMemorySurface[0];
         dst.globalConstants.size = surface->InlineDataSize;
@@ -9,20 +9,61 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 
-#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
 #include <unordered_map>
-#include <vector>
 
 namespace NEO {
 
-struct HeapChunk {
-    HeapChunk(uint64_t ptr, size_t size) : ptr(ptr), size(size) {}
-    uint64_t ptr;
-    size_t size;
-};
+class HeapFreedChunks {
+  public:
+    using ChunksByAddress = std::map<uint64_t, size_t>;
+    using iterator = ChunksByAddress::iterator;
+
+    size_t size() const { return chunksByAddress.size(); }
+    bool empty() const { return chunksByAddress.empty(); }
+    iterator begin() { return chunksByAddress.begin(); }
+    iterator end() { return chunksByAddress.end(); }
+    iterator find(uint64_t ptr) { return chunksByAddress.find(ptr); }
+    iterator lowerBound(uint64_t ptr) { return chunksByAddress.lower_bound(ptr); }
+
+    iterator emplace(uint64_t ptr, size_t size) {
+        auto result = chunksByAddress.emplace(ptr, size);
+        DEBUG_BREAK_IF(!result.second);
+        if (result.second) {
+            chunksBySize.emplace(size, ptr);
+        }
+        return result.first;
+    }
+
+    void erase(iterator chunk) {
+        chunksBySize.erase({chunk->second, chunk->first});
+        chunksByAddress.erase(chunk);
+    }
+
+    void resize(iterator chunk, size_t size) {
+        chunksBySize.erase({chunk->second, chunk->first});
+        chunk->second = size;
+        chunksBySize.emplace(size, chunk->first);
+    }
+
+    // smallest aligned chunk that fits, lowest address first among equal sizes
+    iterator findBestFit(size_t size, size_t alignment) {
+        for (auto it = chunksBySize.lower_bound({size, 0llu}); it != chunksBySize.end(); it++) {
+            if (isAligned(it->second, alignment)) {
+                return chunksByAddress.find(it->second);
+            }
+        }
+        return chunksByAddress.end();
+    }
 
-bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
+  protected:
+    ChunksByAddress chunksByAddress;
+    std::set<std::pair<size_t, uint64_t>> chunksBySize;
+};
 
 class HeapAllocator {
   public:
@@ -35,8 +76,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t allocationAlignment, size_t threshold) : size(size), availableSize(size), allocationAlignment(allocationAlignment), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -57,7 +96,7 @@ class HeapAllocator {
             return 0llu;
         }
 
-        std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+        HeapFreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
         uint32_t defragmentCount = 0;
 
         for (;;) {
@@ -150,134 +189,93 @@ class HeapAllocator {
     size_t allocationAlignment;
     const size_t sizeThreshold;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    HeapFreedChunks freedChunksSmall;
+    HeapFreedChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
-        size_t elements = freedChunks.size();
-        size_t bestFitIndex = -1;
-        size_t bestFitSize = 0;
+    uint64_t getFromFreedChunks(size_t size, HeapFreedChunks &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
         sizeOfFreedChunk = 0;
 
-        for (size_t i = 0; i < elements; i++) {
-            const bool chunkAligned = isAligned(freedChunks[i].ptr, requiredAlignment);
-            if (!chunkAligned) {
-                continue;
-            }
-
-            if (freedChunks[i].size == size) {
-                auto ptr = freedChunks[i].ptr;
-                freedChunks.erase(freedChunks.begin() + i);
-                return ptr;
-            }
+        auto bestFit = freedChunks.findBestFit(size, requiredAlignment);
+        if (bestFit == freedChunks.end()) {
+            return 0llu;
+        }
 
-            if (freedChunks[i].size > size) {
-                if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                    bestFitIndex = i;
-                    bestFitSize = freedChunks[i].size;
-                }
-            }
+        auto ptr = bestFit->first;
+        auto bestFitSize = bestFit->second;
+        if (bestFitSize == size) {
+            freedChunks.erase(bestFit);
+            return ptr;
+        }
+        if (bestFitSize < (size << 1)) {
+            sizeOfFreedChunk = bestFitSize;
+            freedChunks.erase(bestFit);
+            return ptr;
         }
 
-        if (bestFitSize != 0) {
-            if (bestFitSize < (size << 1)) {
-                auto ptr = freedChunks[bestFitIndex].ptr;
-                sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-                freedChunks.erase(freedChunks.begin() + bestFitIndex);
-                return ptr;
-            } else {
-                size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+        size_t sizeDelta = bestFitSize - size;
 
-                DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-                auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-                freedChunks[bestFitIndex].size = sizeDelta;
-                return ptr;
-            }
-        }
-        return 0llu;
+        freedChunks.resize(bestFit, sizeDelta);
+        return ptr + sizeDelta;
     }
 
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-            if ((freedChunk.ptr + freedChunk.size) == (ptr + size)) {
-                if (ptr < freedChunk.ptr) {
-                    freedChunk.ptr = ptr;
-                    freedChunk.size = size;
-                    return;
+    void storeInFreedChunks(uint64_t ptr, size_t size, HeapFreedChunks &freedChunks) {
+        auto rightNeighbour = freedChunks.find(ptr + size);
+        auto leftNeighbour = freedChunks.lowerBound(ptr);
+        if (leftNeighbour != freedChunks.begin()) {
+            leftNeighbour = std::prev(leftNeighbour);
+            if (leftNeighbour->first + leftNeighbour->second == ptr) {
+                auto mergedSize = leftNeighbour->second + size;
+                if (rightNeighbour != freedChunks.end()) {
+                    mergedSize += rightNeighbour->second;
+                    freedChunks.erase(rightNeighbour);
                 }
+                freedChunks.resize(leftNeighbour, mergedSize);
+                return;
             }
         }
+        if (rightNeighbour != freedChunks.end()) {
+            auto mergedSize = size + rightNeighbour->second;
+            freedChunks.erase(rightNeighbour);
+            freedChunks.emplace(ptr, mergedSize);
+            return;
+        }
 
-        freedChunks.emplace_back(ptr, size);
+        // stored chunk ending where the freed range ends is covered by it
+        auto coveredChunk = freedChunks.lowerBound(ptr + size);
+        if (coveredChunk != freedChunks.begin()) {
+            coveredChunk = std::prev(coveredChunk);
+            if (coveredChunk->first > ptr && coveredChunk->first + coveredChunk->second == ptr + size) {
+                freedChunks.erase(coveredChunk);
+            }
+        }
+        freedChunks.emplace(ptr, size);
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
+        auto chunk = freedChunksSmall.find(pRightBound);
+        if (chunk != freedChunksSmall.end()) {
+            pRightBound += chunk->second;
+            freedChunksSmall.erase(chunk);
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
+        if (freedChunksBig.empty()) {
+            return;
+        }
+        auto chunk = std::prev(freedChunksBig.end());
+        if (chunk->first + chunk->second == pLeftBound) {
+            pLeftBound = chunk->first;
+            freedChunksBig.erase(chunk);
         }
     }
 
     void defragment() {
-
-        if (freedChunksSmall.size() > 1) {
-            std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-            size_t maxSize = freedChunksSmall.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksSmall[i].ptr;
-                size_t chunkSize = freedChunksSmall[i].size;
-
-                if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                    freedChunksSmall[i - 1].ptr = ptr;
-                    freedChunksSmall[i - 1].size += chunkSize;
-                    freedChunksSmall.erase(freedChunksSmall.begin() + i);
-                }
-            }
-        }
+        // stored chunks are coalesced with their neighbours already, only the bounds may still grow
         mergeLastFreedSmall();
-        if (freedChunksBig.size() > 1) {
-            std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-            size_t maxSize = freedChunksBig.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksBig[i].ptr;
-                size_t chunkSize = freedChunksBig[i].size;
-                if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                    freedChunksBig[i - 1].size += chunkSize;
-                    freedChunksBig.erase(freedChunksBig.begin() + i);
-                }
-            }
-        }
         mergeLastFreedBig();
         DBG_LOG(LogAllocationMemoryPool, __FUNCTION__, "Allocator usage == ", this->getUsage());
     }
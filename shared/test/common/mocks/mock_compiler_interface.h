@@ -164,6 +164,7 @@ struct MockCompilerInterfaceCaptureBuildOptions : CompilerInterface {
         if ((input.internalOptions.size() > 0) && (input.internalOptions.begin() != nullptr)) {
             buildInternalOptions.assign(input.internalOptions.begin(), input.internalOptions.end());
         }
+        allowCaching = input.allowCaching;
         return TranslationOutput::ErrorCode::Success;
     }
 
@@ -179,5 +180,6 @@ struct MockCompilerInterfaceCaptureBuildOptions : CompilerInterface {
 
     std::string buildOptions;
     std::string buildInternalOptions;
+    bool allowCaching = false;
 };
 } // namespace NEO
@@ -16,7 +16,7 @@ template <typename GfxFamily, typename Dispatcher>
 struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::allocateResources;
-    using BaseClass::completionRingBuffers;
+    using BaseClass::allocateRingBuffer;
     using BaseClass::cpuCachelineFlush;
     using BaseClass::currentQueueWorkCount;
     using BaseClass::currentRingBuffer;
@@ -43,18 +43,25 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeStartSection;
     using BaseClass::getSizeSwitchRingBufferSection;
     using BaseClass::hwInfo;
+    using BaseClass::maxRingBufferCount;
+    using BaseClass::maxRingBufferSize;
     using BaseClass::osContext;
     using BaseClass::performDiagnosticMode;
-    using BaseClass::ringBuffer;
-    using BaseClass::ringBuffer2;
+    using BaseClass::previousRingBuffer;
+    using BaseClass::ringBufferFillStart;
+    using BaseClass::ringBufferGrowthThresholdUs;
+    using BaseClass::ringBuffers;
+    using BaseClass::ringBufferSize;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
+    using BaseClass::ringStatistics;
     using BaseClass::semaphoreData;
     using BaseClass::semaphoreGpuVa;
     using BaseClass::semaphorePtr;
     using BaseClass::semaphores;
     using BaseClass::setReturnAddress;
     using BaseClass::stopRingBuffer;
+    using BaseClass::switchRingBuffers;
     using BaseClass::switchRingBuffersAllocations;
     using BaseClass::workloadMode;
     using BaseClass::workloadModeOneExpectedValue;
@@ -93,6 +100,11 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
 
     void handleSwitchRingBuffers() override {}
 
+    bool isCompleted(uint32_t ringBufferIndex) override {
+        isCompletedCalled++;
+        return isCompletedReturn;
+    }
+
     uint64_t updateTagValue() override {
         return updateTagValueReturn;
     }
@@ -122,9 +134,11 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     uint32_t submitCount = 0u;
     uint32_t handleResidencyCount = 0u;
     uint32_t disabledDiagnosticCalled = 0u;
+    uint32_t isCompletedCalled = 0u;
     bool allocateOsResourcesReturn = true;
     bool submitReturn = true;
     bool handleResidencyReturn = true;
     bool callBaseResident = false;
+    bool isCompletedReturn = true;
 };
 } // namespace NEO
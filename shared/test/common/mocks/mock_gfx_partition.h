@@ -48,6 +48,10 @@ class MockGfxPartition : public GfxPartition {
         }
     }
 
+    void heapInitMagazines(HeapIndex heapIndex, size_t magazineSize) {
+        getHeap(heapIndex).initMagazines(magazineSize);
+    }
+
     static std::array<HeapIndex, static_cast<uint32_t>(HeapIndex::TOTAL_HEAPS)> allHeapNames;
 
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRange;
@@ -16,7 +16,6 @@ struct MockWddmDirectSubmission : public WddmDirectSubmission<GfxFamily, Dispatc
     using BaseClass::allocateOsResources;
     using BaseClass::allocateResources;
     using BaseClass::commandBufferHeader;
-    using BaseClass::completionRingBuffers;
     using BaseClass::currentRingBuffer;
     using BaseClass::getSizeDispatch;
     using BaseClass::getSizeSemaphoreSection;
@@ -24,12 +23,15 @@ struct MockWddmDirectSubmission : public WddmDirectSubmission<GfxFamily, Dispatc
     using BaseClass::getTagAddressValue;
     using BaseClass::handleCompletionRingBuffer;
     using BaseClass::handleResidency;
+    using BaseClass::isCompleted;
+    using BaseClass::maxRingBufferCount;
     using BaseClass::osContextWin;
-    using BaseClass::ringBuffer;
-    using BaseClass::ringBuffer2;
+    using BaseClass::previousRingBuffer;
+    using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
     using BaseClass::ringFence;
     using BaseClass::ringStart;
+    using BaseClass::ringStatistics;
     using BaseClass::semaphores;
     using BaseClass::submit;
     using BaseClass::switchRingBuffers;
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/build_worker_pool.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "test.h"
+
+#include <atomic>
+
+using namespace NEO;
+
+TEST(BuildWorkerPool, givenNoTasksSubmittedThenNoWorkerThreadsAreCreated) {
+    BuildWorkerPool pool(4U);
+    EXPECT_EQ(4U, pool.getMaxWorkersCount());
+    EXPECT_EQ(0U, pool.getWorkersCount());
+    pool.waitForIdle();
+}
+
+TEST(BuildWorkerPool, givenZeroMaxWorkersThenSingleWorkerIsAllowed) {
+    BuildWorkerPool pool(0U);
+    EXPECT_EQ(1U, pool.getMaxWorkersCount());
+}
+
+TEST(BuildWorkerPool, givenSubmittedTasksWhenWaitingForIdleThenAllTasksAreExecutedWithinWorkersLimit) {
+    BuildWorkerPool pool(2U);
+    std::atomic<uint32_t> tasksExecuted{0U};
+    for (uint32_t i = 0; i < 16; ++i) {
+        pool.submit([&tasksExecuted] { ++tasksExecuted; });
+    }
+    pool.waitForIdle();
+    EXPECT_EQ(16U, tasksExecuted.load());
+    EXPECT_LE(pool.getWorkersCount(), 2U);
+    EXPECT_GE(pool.getWorkersCount(), 1U);
+}
+
+TEST(BuildWorkerPool, givenPendingTasksWhenPoolIsDestroyedThenPendingTasksAreExecuted) {
+    std::atomic<uint32_t> tasksExecuted{0U};
+    {
+        BuildWorkerPool pool(1U);
+        for (uint32_t i = 0; i < 8; ++i) {
+            pool.submit([&tasksExecuted] { ++tasksExecuted; });
+        }
+    }
+    EXPECT_EQ(8U, tasksExecuted.load());
+}
+
+TEST(BuildWorkerPool, givenAsyncBuildWorkerThreadsDebugFlagWhenGettingDefaultWorkersCountThenFlagValueIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AsyncBuildWorkerThreads.set(3);
+    EXPECT_EQ(3U, BuildWorkerPool::getDefaultWorkersCount());
+
+    DebugManager.flags.AsyncBuildWorkerThreads.set(-1);
+    auto defaultWorkersCount = BuildWorkerPool::getDefaultWorkersCount();
+    EXPECT_LE(1U, defaultWorkersCount);
+    EXPECT_GE(4U, defaultWorkersCount);
+}
+
+TEST(BuildWorkerPool, givenTaskDestroyingPoolWhenTaskIsExecutedThenWorkerIsNotJoinedFromItself) {
+    std::atomic<bool> submitted{false};
+    std::atomic<bool> poolDestroyed{false};
+    auto pool = new BuildWorkerPool(1U);
+    pool->submit([&] {
+        while (false == submitted.load()) {
+            std::this_thread::yield();
+        }
+        delete pool;
+        poolDestroyed = true;
+    });
+    submitted = true;
+    while (false == poolDestroyed.load()) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(poolDestroyed.load());
+}
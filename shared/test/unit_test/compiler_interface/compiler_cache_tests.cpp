@@ -8,19 +8,26 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/test_files.h"
+
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/global_environment.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
+#include "os_inc.h"
 #include "test.h"
 
 #include <array>
+#include <cstdio>
 #include <list>
+#include <map>
 #include <memory>
 
 using namespace NEO;
@@ -36,12 +43,64 @@ class CompilerCacheMock : public CompilerCache {
     }
 
     std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        lastLoadedHash = kernelFileHash;
         return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
     }
 
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
+    std::string lastLoadedHash;
+};
+
+class CompilerCacheEntriesMock : public CompilerCache {
+  public:
+    CompilerCacheEntriesMock() : CompilerCache(CompilerCacheConfig{}) {
+    }
+
+    bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+        entries[kernelFileHash].assign(pBinary, pBinary + binarySize);
+        return true;
+    }
+
+    std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        auto it = entries.find(kernelFileHash);
+        if (it == entries.end()) {
+            cachedBinarySize = 0U;
+            return nullptr;
+        }
+        cachedBinarySize = it->second.size();
+        return makeCopy(it->second.data(), it->second.size());
+    }
+
+    std::map<std::string, std::vector<char>> entries;
+};
+
+struct IncludeDependenciesFixture {
+    IncludeDependenciesFixture(const std::string &dir = clFiles) {
+        includeDir = dir.substr(0, dir.find_last_not_of("/\\") + 1);
+        options = "-I " + includeDir;
+        headerA = includeDir + PATH_SEPARATOR + "compiler_cache_tests_a.h";
+        headerB = includeDir + PATH_SEPARATOR + "compiler_cache_tests_b.h";
+        writeDataToFile(headerA.c_str(), headerAContent, strlen(headerAContent));
+        writeDataToFile(headerB.c_str(), headerBContent, strlen(headerBContent));
+    }
+
+    ~IncludeDependenciesFixture() {
+        std::remove(headerA.c_str());
+        std::remove(headerB.c_str());
+    }
+
+    ArrayRef<const char> getOptions() const {
+        return ArrayRef<const char>(options.c_str(), options.size());
+    }
+
+    std::string includeDir;
+    std::string options;
+    std::string headerA;
+    std::string headerB;
+    const char *headerAContent = "#include \"compiler_cache_tests_b.h\"\n#define A 1\n";
+    const char *headerBContent = "  #  include \"compiler_cache_tests_a.h\"\n#define B 2\n";
 };
 
 TEST(HashGeneration, givenMisalignedBufferWhenPassedToUpdateFunctionThenProperPtrDataIsUsed) {
@@ -219,6 +278,173 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, GivenSpecConstantsWhenGettingCacheNameThenValuesAreIncorporatedIntoHash) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "spirv";
+    const char apiOptions[] = "-cl-opt-disable";
+    const char internalOptions[] = "";
+    ArrayRef<const char> srcRef(src);
+    ArrayRef<const char> apiOptionsRef(apiOptions);
+    ArrayRef<const char> internalOptionsRef(internalOptions);
+
+    specConstValuesMap noSpecConstants;
+    specConstValuesMap specConstants1{{1U, 5U}, {2U, 7U}};
+    specConstValuesMap specConstants2{{1U, 5U}, {2U, 8U}};
+    specConstValuesMap specConstants3{{1U, 7U}, {2U, 5U}};
+
+    auto hashNoSpecConstants = CompilerCache::getCachedFileName(hwInfo, srcRef, apiOptionsRef, internalOptionsRef);
+    EXPECT_STREQ(hashNoSpecConstants.c_str(), CompilerCache::getCachedFileName(hwInfo, srcRef, apiOptionsRef, internalOptionsRef, noSpecConstants).c_str());
+
+    auto hash1 = CompilerCache::getCachedFileName(hwInfo, srcRef, apiOptionsRef, internalOptionsRef, specConstants1);
+    auto hash2 = CompilerCache::getCachedFileName(hwInfo, srcRef, apiOptionsRef, internalOptionsRef, specConstants2);
+    auto hash3 = CompilerCache::getCachedFileName(hwInfo, srcRef, apiOptionsRef, internalOptionsRef, specConstants3);
+    EXPECT_STRNE(hashNoSpecConstants.c_str(), hash1.c_str());
+    EXPECT_STRNE(hash1.c_str(), hash2.c_str());
+    EXPECT_STRNE(hash1.c_str(), hash3.c_str());
+    EXPECT_STRNE(hash2.c_str(), hash3.c_str());
+}
+
+TEST(CompilerCacheHashTests, GivenSameSpecConstantsInsertedInDifferentOrderWhenGettingCacheNameThenHashesAreEqual) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "spirv";
+    ArrayRef<const char> srcRef(src);
+
+    specConstValuesMap specConstants1;
+    specConstValuesMap specConstants2;
+    for (uint32_t i = 0; i < 64; ++i) {
+        specConstants1[i] = i * 3;
+        specConstants2[63 - i] = (63 - i) * 3;
+    }
+
+    auto hash1 = CompilerCache::getCachedFileName(hwInfo, srcRef, srcRef, srcRef, specConstants1);
+    auto hash2 = CompilerCache::getCachedFileName(hwInfo, srcRef, srcRef, srcRef, specConstants2);
+    EXPECT_STREQ(hash1.c_str(), hash2.c_str());
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenSourceWithNestedIncludesWhenResolvingDependenciesThenAllHeadersAreRecordedOnce) {
+    IncludeDependenciesFixture fixture;
+    const char src[] = "#include \"compiler_cache_tests_a.h\"\n__kernel void k() {}";
+
+    IncludeDependencies includes;
+    EXPECT_TRUE(CompilerCache::resolveIncludeDependencies(ArrayRef<const char>(src, strlen(src)), fixture.getOptions(), includes));
+    ASSERT_EQ(2U, includes.size());
+    EXPECT_EQ(fixture.headerA, includes[0].path);
+    EXPECT_EQ(Hash::hash(fixture.headerAContent, strlen(fixture.headerAContent)), includes[0].contentHash);
+    EXPECT_EQ(fixture.headerB, includes[1].path);
+    EXPECT_EQ(Hash::hash(fixture.headerBContent, strlen(fixture.headerBContent)), includes[1].contentHash);
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenForcedIncludeInOptionsWhenResolvingDependenciesThenForcedHeaderIsRecordedAndTracked) {
+    IncludeDependenciesFixture fixture;
+    const char src[] = "__kernel void k() {}";
+    auto srcRef = ArrayRef<const char>(src, strlen(src));
+    std::string options = fixture.options + " -include compiler_cache_tests_a.h";
+    auto optionsRef = ArrayRef<const char>(options.c_str(), options.size());
+
+    IncludeDependencies includes;
+    ASSERT_TRUE(CompilerCache::resolveIncludeDependencies(srcRef, optionsRef, includes));
+    ASSERT_EQ(2U, includes.size());
+    EXPECT_EQ(fixture.headerA, includes[0].path);
+    EXPECT_EQ(fixture.headerB, includes[1].path);
+
+    auto manifest = CompilerCache::serializeIncludeManifest(includes);
+    auto manifestRef = ArrayRef<const char>(manifest.c_str(), manifest.size());
+    IncludeDependencies validatedIncludes;
+    EXPECT_TRUE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, optionsRef, validatedIncludes));
+
+    const char changedContent[] = "#define A 3\n";
+    writeDataToFile(fixture.headerA.c_str(), changedContent, strlen(changedContent));
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, optionsRef, validatedIncludes));
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenIncludeDirInOptionsWhenResolvingDependenciesThenHeaderIsSearchedInIncludeDir) {
+    const char src[] = "#include <simple_header.h>\n";
+    std::string options = "-cl-std=CL2.0 -I " + clFiles;
+
+    IncludeDependencies includes;
+    EXPECT_FALSE(CompilerCache::resolveIncludeDependencies(ArrayRef<const char>(src, strlen(src)), {}, includes));
+    EXPECT_TRUE(CompilerCache::resolveIncludeDependencies(ArrayRef<const char>(src, strlen(src)), ArrayRef<const char>(options.c_str(), options.size()), includes));
+    ASSERT_EQ(1U, includes.size());
+    EXPECT_TRUE(fileExists(includes[0].path));
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenUnresolvableIncludeWhenResolvingDependenciesThenFalseIsReturned) {
+    const char missingHeaderSrc[] = "#include \"compiler_cache_tests_missing.h\"\n";
+    const char computedIncludeSrc[] = "#include HEADER_NAME\n";
+
+    IncludeDependencies includes;
+    EXPECT_FALSE(CompilerCache::resolveIncludeDependencies(ArrayRef<const char>(missingHeaderSrc, strlen(missingHeaderSrc)), {}, includes));
+    EXPECT_FALSE(CompilerCache::resolveIncludeDependencies(ArrayRef<const char>(computedIncludeSrc, strlen(computedIncludeSrc)), {}, includes));
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenSerializedManifestWhenHeadersAreUnchangedThenManifestIsValidAndCacheNameIsStable) {
+    IncludeDependenciesFixture fixture;
+    const char src[] = "#include \"compiler_cache_tests_a.h\"\n";
+
+    auto srcRef = ArrayRef<const char>(src, strlen(src));
+
+    IncludeDependencies includes;
+    ASSERT_TRUE(CompilerCache::resolveIncludeDependencies(srcRef, fixture.getOptions(), includes));
+    auto manifest = CompilerCache::serializeIncludeManifest(includes);
+
+    IncludeDependencies validatedIncludes;
+    EXPECT_TRUE(CompilerCache::validateIncludeManifest(ArrayRef<const char>(manifest.c_str(), manifest.size()), srcRef, fixture.getOptions(), validatedIncludes));
+    ASSERT_EQ(includes.size(), validatedIncludes.size());
+    EXPECT_EQ(CompilerCache::getCachedFileName("base", includes), CompilerCache::getCachedFileName("base", validatedIncludes));
+    EXPECT_NE(CompilerCache::getCachedFileName("base", includes), CompilerCache::getCachedFileName("other", includes));
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenSerializedManifestWhenHeaderChangesOrIsRemovedThenManifestIsInvalid) {
+    IncludeDependenciesFixture fixture;
+    const char src[] = "#include \"compiler_cache_tests_a.h\"\n";
+    auto srcRef = ArrayRef<const char>(src, strlen(src));
+
+    IncludeDependencies includes;
+    ASSERT_TRUE(CompilerCache::resolveIncludeDependencies(srcRef, fixture.getOptions(), includes));
+    auto manifest = CompilerCache::serializeIncludeManifest(includes);
+    auto manifestRef = ArrayRef<const char>(manifest.c_str(), manifest.size());
+
+    const char changedContent[] = "#define B 3\n";
+    writeDataToFile(fixture.headerB.c_str(), changedContent, strlen(changedContent));
+    IncludeDependencies validatedIncludes;
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, fixture.getOptions(), validatedIncludes));
+
+    std::remove(fixture.headerB.c_str());
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, fixture.getOptions(), validatedIncludes));
+
+    const char invalidManifest[] = "not a manifest";
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(ArrayRef<const char>(invalidManifest, strlen(invalidManifest)), srcRef, fixture.getOptions(), validatedIncludes));
+}
+
+TEST(CompilerCacheIncludeManifestTests, GivenSerializedManifestWhenNewHeaderShadowsRecordedOneInSearchOrderThenManifestIsInvalid) {
+    IncludeDependenciesFixture fixture;
+    IncludeDependenciesFixture shadowingFixture(testFiles);
+    const char src[] = "#include <compiler_cache_tests_a.h>\n";
+    auto srcRef = ArrayRef<const char>(src, strlen(src));
+    std::string options = "-I " + shadowingFixture.includeDir + " -I " + fixture.includeDir;
+    auto optionsRef = ArrayRef<const char>(options.c_str(), options.size());
+
+    std::remove(shadowingFixture.headerA.c_str());
+    std::remove(shadowingFixture.headerB.c_str());
+
+    IncludeDependencies includes;
+    ASSERT_TRUE(CompilerCache::resolveIncludeDependencies(srcRef, optionsRef, includes));
+    ASSERT_EQ(2U, includes.size());
+    EXPECT_EQ(fixture.headerA, includes[0].path);
+    auto manifest = CompilerCache::serializeIncludeManifest(includes);
+    auto manifestRef = ArrayRef<const char>(manifest.c_str(), manifest.size());
+
+    IncludeDependencies validatedIncludes;
+    EXPECT_TRUE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, optionsRef, validatedIncludes));
+
+    const char shadowingContent[] = "#define A 2\n";
+    writeDataToFile(shadowingFixture.headerA.c_str(), shadowingContent, strlen(shadowingContent));
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, optionsRef, validatedIncludes));
+
+    writeDataToFile(shadowingFixture.headerA.c_str(), fixture.headerAContent, strlen(fixture.headerAContent));
+    EXPECT_FALSE(CompilerCache::validateIncludeManifest(manifestRef, srcRef, optionsRef, validatedIncludes));
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -311,6 +537,40 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, givenSpirVWithDifferentSpecConstantValuesWhenBuildingThenDifferentCacheEntriesAreUsed) {
+    TranslationInput inputArgs{IGC::CodeType::spirV, IGC::CodeType::oclGenBin};
+
+    auto src = "spirv";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), false));
+    ASSERT_NE(nullptr, compilerInterface);
+    MockDevice device;
+
+    TranslationOutput translationOutput1;
+    inputArgs.specializedValues[1U] = 5U;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput1));
+    auto hash1 = cache->lastLoadedHash;
+
+    TranslationOutput translationOutput2;
+    inputArgs.specializedValues[1U] = 6U;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput2));
+    auto hash2 = cache->lastLoadedHash;
+
+    EXPECT_FALSE(hash1.empty());
+    EXPECT_STRNE(hash1.c_str(), hash2.c_str());
+
+    gEnvironment->igcPopDebugVars();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
     MockClDevice device{new MockDevice};
     MockContext context(&device, true);
@@ -343,6 +603,83 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhe
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, givenKernelWithResolvableIncludesAndValidManifestInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
+    IncludeDependenciesFixture fixture;
+    MockClDevice device{new MockDevice};
+    MockContext context(&device, true);
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "#include \"compiler_cache_tests_a.h\"\n__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.apiOptions = fixture.getOptions();
+    inputArgs.allowCaching = true;
+
+    // we force both compilers to fail compilation request
+    // at the end we expect success which means compilation ends in cache
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheEntriesMock();
+    auto baseFileHash = CompilerCache::getCachedFileName(device.getDevice().getHardwareInfo(), inputArgs.src, inputArgs.apiOptions, inputArgs.internalOptions);
+    IncludeDependencies includes;
+    ASSERT_TRUE(CompilerCache::resolveIncludeDependencies(inputArgs.src, fixture.getOptions(), includes));
+    auto manifest = CompilerCache::serializeIncludeManifest(includes);
+    const char binary[] = "binary";
+    cache->cacheBinary(CompilerCache::getIncludeManifestName(baseFileHash), manifest.c_str(), static_cast<uint32_t>(manifest.size()));
+    cache->cacheBinary(CompilerCache::getCachedFileName(baseFileHash, includes), binary, sizeof(binary));
+
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    auto retVal = compilerInterface->build(device.getDevice(), inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, retVal);
+    EXPECT_EQ(sizeof(binary), translationOutput.deviceBinary.size);
+
+    const char changedContent[] = "#define B 3\n";
+    writeDataToFile(fixture.headerB.c_str(), changedContent, strlen(changedContent));
+    TranslationOutput translationOutputAfterHeaderChange;
+    retVal = compilerInterface->build(device.getDevice(), inputArgs, translationOutputAfterHeaderChange);
+    EXPECT_EQ(TranslationOutput::ErrorCode::BuildFailure, retVal);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenIncludeManifestDisabledWhenKernelWithResolvableIncludesIsBuiltThenManifestIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCompilerCacheIncludeManifest.set(0);
+
+    IncludeDependenciesFixture fixture;
+    MockClDevice device{new MockDevice};
+    MockContext context(&device, true);
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "#include \"compiler_cache_tests_a.h\"\n__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.apiOptions = fixture.getOptions();
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    auto cache = new CompilerCacheEntriesMock();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    auto retVal = compilerInterface->build(device.getDevice(), inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::BuildFailure, retVal);
+    EXPECT_TRUE(cache->entries.empty());
+
+    gEnvironment->fclPopDebugVars();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsCalled) {
     MockClDevice device{new MockDevice};
     MockContext context(&device, true);
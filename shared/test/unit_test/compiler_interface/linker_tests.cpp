@@ -423,6 +423,56 @@ TEST(LinkerInputTests, WhenDecodingElfTextRelocationsThenCorrectRelocationsAreAd
     EXPECT_EQ(NEO::LinkerInput::RelocationInfo::Type::AddressLow, segment1Relocs[0].type);
 }
 
+TEST(LinkerInputTests, GivenManyRelocationsInSameSectionsWhenDecodingElfTextRelocationsThenSectionNamesAreQueriedOncePerSection) {
+    struct ElfCountingSectionNameQueries : MockElf<NEO::Elf::EI_CLASS_64> {
+        std::string getSectionName(uint32_t id) const override {
+            ++sectionNameQueries;
+            return MockElf<NEO::Elf::EI_CLASS_64>::getSectionName(id);
+        }
+        mutable uint32_t sectionNameQueries = 0U;
+    };
+
+    NEO::LinkerInput linkerInput = {};
+    NEO::Elf::ElfFileHeader<NEO::Elf::EI_CLASS_64> header;
+    ElfCountingSectionNameQueries elf64;
+    elf64.elfFileHeader = &header;
+
+    std::unordered_map<uint32_t, std::string> sectionNames;
+    sectionNames[0] = ".text.abc";
+    sectionNames[1] = ".text.hello";
+    elf64.setupSecionNames(std::move(sectionNames));
+
+    constexpr uint32_t relocationsPerSection = 64U;
+    for (uint32_t i = 0; i < 2 * relocationsPerSection; ++i) {
+        NEO::Elf::Elf<NEO::Elf::EI_CLASS_64>::RelocationInfo reloc;
+        reloc.offset = 8 * i;
+        reloc.relocType = static_cast<uint32_t>(Elf::RELOCATION_X8664_TYPE::R_X8664_64);
+        reloc.symbolName = "symbol" + std::to_string(i % 3);
+        reloc.symbolSectionIndex = 0;
+        reloc.symbolTableIndex = 0;
+        reloc.targetSectionIndex = i % 2;
+        elf64.relocations.emplace_back(reloc);
+    }
+
+    NEO::LinkerInput::SectionNameToSegmentIdMap nameToKernelId;
+    nameToKernelId["abc"] = 0;
+    nameToKernelId["hello"] = 1;
+
+    linkerInput.decodeElfSymbolTableAndRelocations(elf64, nameToKernelId);
+    EXPECT_EQ(2U, elf64.sectionNameQueries);
+
+    auto &relocations = linkerInput.getRelocationsInInstructionSegments();
+    ASSERT_EQ(2U, relocations.size());
+    ASSERT_EQ(relocationsPerSection, relocations[0].size());
+    ASSERT_EQ(relocationsPerSection, relocations[1].size());
+    for (uint32_t i = 0; i < relocationsPerSection; ++i) {
+        EXPECT_EQ(16U * i, relocations[0][i].offset);
+        EXPECT_EQ("symbol" + std::to_string((2 * i) % 3), relocations[0][i].symbolName);
+        EXPECT_EQ(16U * i + 8U, relocations[1][i].offset);
+        EXPECT_EQ("symbol" + std::to_string((2 * i + 1) % 3), relocations[1][i].symbolName);
+    }
+}
+
 TEST(LinkerInputTests, GivenNoKernelNameToIdWhenDecodingElfTextRelocationsThenNoRelocationIsAdded) {
     NEO::LinkerInput linkerInput = {};
     NEO::Elf::ElfFileHeader<NEO::Elf::EI_CLASS_64> header;
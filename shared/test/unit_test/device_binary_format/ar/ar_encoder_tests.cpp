@@ -148,3 +148,37 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, GivenExternalDataReferencedThenEncodedArIsSameAsWhenDataIsCopied) {
+    const uint8_t data0[7] = "123456";
+    const uint8_t data1[16] = "9ABCDEFGHIJKLMN";
+
+    ArEncoder copyingEncoder(true);
+    ASSERT_NE(nullptr, copyingEncoder.appendFileEntry("a", data0));
+    ASSERT_NE(nullptr, copyingEncoder.appendFileEntry("b", data1));
+
+    ArEncoder referencingEncoder(true);
+    referencingEncoder.setReferenceExternalData(true);
+    ASSERT_NE(nullptr, referencingEncoder.appendFileEntry("a", data0));
+    ASSERT_NE(nullptr, referencingEncoder.appendFileEntry("b", data1));
+
+    EXPECT_EQ(copyingEncoder.encode(), referencingEncoder.encode());
+}
+
+TEST(ArEncoder, WhenEncodingToPreallocatedBufferThenOnlyBigEnoughBufferIsWrittenAndResultIsSameAsEncodedVector) {
+    const uint8_t data0[7] = "123456";
+    ArEncoder encoder(true);
+    auto header = encoder.appendFileEntry("a", data0);
+    ASSERT_NE(nullptr, header);
+    auto arData = encoder.encode();
+    ASSERT_EQ(arData.size(), encoder.getEncodedSize());
+    EXPECT_EQ(0, memcmp(header, arData.data() + arData.size() - sizeof(data0) - 1 - sizeof(ArFileEntryHeader), sizeof(ArFileEntryHeader)));
+
+    std::vector<uint8_t> tooSmall(arData.size() - 1, 0xFFU);
+    EXPECT_EQ(arData.size(), encoder.encode(ArrayRef<uint8_t>(tooSmall)));
+    EXPECT_EQ(std::vector<uint8_t>(arData.size() - 1, 0xFFU), tooSmall);
+
+    std::vector<uint8_t> preallocated(arData.size(), 0xFFU);
+    EXPECT_EQ(arData.size(), encoder.encode(ArrayRef<uint8_t>(preallocated)));
+    EXPECT_EQ(arData, preallocated);
+}
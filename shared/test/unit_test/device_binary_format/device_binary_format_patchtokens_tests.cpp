@@ -154,3 +154,45 @@ TEST(DecodeSingleDeviceBinaryPatchtokens, GivenValidBinaryThenOutputIsProperlyPo
     EXPECT_TRUE(decodeErrors.empty());
     ASSERT_EQ(1U, programInfo.kernelInfos.size());
 }
+
+TEST(DecodeSingleDeviceBinaryPatchtokens, GivenMultipleKernelsThenEachKernelIsDecodedAndPopulated) {
+    PatchTokensTestData::ValidProgramWithKernel programTokens;
+    auto kernelSize = programTokens.storage.size() - programTokens.kernOffset;
+    std::vector<uint8_t> kernelBlob(programTokens.storage.begin() + programTokens.kernOffset, programTokens.storage.end());
+    programTokens.storage.insert(programTokens.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    programTokens.recalcTokPtr();
+    programTokens.headerMutable->NumberOfKernels = 2;
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = ArrayRef<const uint8_t>(programTokens.storage.data(), programTokens.kernOffset + 2 * kernelSize);
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::Success, error);
+    EXPECT_TRUE(decodeWarnings.empty());
+    EXPECT_TRUE(decodeErrors.empty()) << decodeErrors;
+    EXPECT_EQ(2U, programInfo.kernelInfos.size());
+}
+
+TEST(DecodeSingleDeviceBinaryPatchtokens, GivenInvalidKernelAfterValidOneThenReturnErrorAndDontLeavePartiallyPopulatedOutput) {
+    PatchTokensTestData::ValidProgramWithKernel programTokens;
+    auto kernelSize = programTokens.storage.size() - programTokens.kernOffset;
+    std::vector<uint8_t> kernelBlob(programTokens.storage.begin() + programTokens.kernOffset, programTokens.storage.end());
+    programTokens.storage.insert(programTokens.storage.end(), kernelBlob.begin(), kernelBlob.end());
+    programTokens.recalcTokPtr();
+    programTokens.headerMutable->NumberOfKernels = 2;
+    auto secondKernelHeader = reinterpret_cast<iOpenCL::SKernelBinaryHeaderCommon *>(programTokens.storage.data() + programTokens.kernOffset + kernelSize);
+    secondKernelHeader->CheckSum += 1;
+
+    NEO::ProgramInfo programInfo;
+    NEO::SingleDeviceBinary singleBinary;
+    singleBinary.deviceBinary = ArrayRef<const uint8_t>(programTokens.storage.data(), programTokens.kernOffset + 2 * kernelSize);
+    std::string decodeErrors;
+    std::string decodeWarnings;
+    auto error = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Patchtokens>(programInfo, singleBinary, decodeErrors, decodeWarnings);
+    EXPECT_EQ(NEO::DecodeError::UnhandledBinary, error);
+    EXPECT_STREQ("KernelFromPatchtokens has invalid checksum", decodeErrors.c_str());
+    EXPECT_TRUE(programInfo.kernelInfos.empty());
+    EXPECT_EQ(nullptr, programInfo.linkerInput);
+}
@@ -456,3 +456,37 @@ TEST(ElfEncoder, WhenAppendingSectionNameThenEmplacedStringIsAlwaysNullterminate
     EXPECT_STREQ("de", reinterpret_cast<const char *>(elfData.data() + sectionNamesSection->offset + strOffset2));
     EXPECT_STREQ("g", reinterpret_cast<const char *>(elfData.data() + sectionNamesSection->offset + strOffset3));
 }
+
+TEST(ElfEncoder, GivenExternalDataReferencedThenEncodedElfIsSameAsWhenDataIsCopied) {
+    const uint8_t segmentData[] = "235711131719";
+    const uint8_t sectionData[] = "232931374143475";
+
+    ElfEncoder<EI_CLASS_64> copyingEncoder(true, true, 16U);
+    copyingEncoder.appendSegment(PT_LOAD, segmentData);
+    copyingEncoder.appendSection(NEO::Elf::SHT_PROGBITS, "my_name_is_important", sectionData);
+
+    ElfEncoder<EI_CLASS_64> referencingEncoder(true, true, 16U);
+    referencingEncoder.setReferenceExternalData(true);
+    referencingEncoder.appendSegment(PT_LOAD, segmentData);
+    referencingEncoder.appendSection(NEO::Elf::SHT_PROGBITS, "my_name_is_important", sectionData);
+
+    auto copiedElf = copyingEncoder.encode();
+    auto referencedElf = referencingEncoder.encode();
+    EXPECT_EQ(copiedElf, referencedElf);
+}
+
+TEST(ElfEncoder, WhenEncodingToPreallocatedBufferThenOnlyBigEnoughBufferIsWrittenAndResultIsSameAsEncodedVector) {
+    const uint8_t sectionData[] = "232931374143475";
+    ElfEncoder<EI_CLASS_64> elfEncoder64;
+    elfEncoder64.appendSection(NEO::Elf::SHT_PROGBITS, "my_name_is_important", sectionData);
+    auto elfData64 = elfEncoder64.encode();
+    ASSERT_EQ(elfData64.size(), elfEncoder64.getEncodedSize());
+
+    std::vector<uint8_t> tooSmall(elfData64.size() - 1, 0xFFU);
+    EXPECT_EQ(elfData64.size(), elfEncoder64.encode(ArrayRef<uint8_t>(tooSmall)));
+    EXPECT_EQ(std::vector<uint8_t>(elfData64.size() - 1, 0xFFU), tooSmall);
+
+    std::vector<uint8_t> preallocated(elfData64.size(), 0xFFU);
+    EXPECT_EQ(elfData64.size(), elfEncoder64.encode(ArrayRef<uint8_t>(preallocated)));
+    EXPECT_EQ(elfData64, preallocated);
+}
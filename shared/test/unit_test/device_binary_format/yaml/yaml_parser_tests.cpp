@@ -2921,3 +2921,39 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+TEST(YamlEstimateTokenizedSize, GivenEmptyTextThenEstimatesSingleLine) {
+    auto estimates = estimateTokenizedSize("");
+    EXPECT_EQ(1U, estimates.numLines);
+    EXPECT_EQ(1U, estimates.numTokens);
+}
+
+TEST(YamlEstimateTokenizedSize, GivenLargeDocumentWhenTokenizingThenEstimatesCoverAllLinesAndTokens) {
+    std::string yaml = "---\nkernels:\n";
+    for (int i = 0; i < 100; ++i) {
+        yaml += "  - name : kernel_" + std::to_string(i) + " # entry\n";
+        yaml += "    execution_env:\n";
+        yaml += "      simd_size : 8\n";
+        yaml += "    payload_arguments:\n";
+        yaml += "      - arg_type : global_id_offset\n";
+        yaml += "        offset : -12\n";
+        yaml += "        size : 12\n";
+    }
+    yaml += "...\n";
+
+    auto estimates = estimateTokenizedSize(yaml);
+
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors;
+    std::string warnings;
+    bool success = NEO::Yaml::tokenize(yaml, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+
+    EXPECT_LE(lines.size(), estimates.numLines);
+    EXPECT_LE(tokens.size(), estimates.numTokens);
+    EXPECT_LE(estimates.numLines, lines.capacity());
+    EXPECT_LE(estimates.numTokens, tokens.capacity());
+}
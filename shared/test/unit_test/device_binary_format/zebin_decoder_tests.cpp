@@ -918,6 +918,86 @@ kernels:
     EXPECT_EQ(NEO::DecodeError::InvalidBinary, err);
 }
 
+TEST(GetZebinDecodeWorkersCount, GivenFewKernelsThenDecodeSequentially) {
+    EXPECT_EQ(1U, NEO::getZebinDecodeWorkersCount(0U));
+    EXPECT_EQ(1U, NEO::getZebinDecodeWorkersCount(NEO::minKernelsCountForParallelZebinDecode - 1));
+}
+
+TEST(GetZebinDecodeWorkersCount, GivenManyKernelsThenWorkersCountIsBounded) {
+    auto workersCount = NEO::getZebinDecodeWorkersCount(NEO::minKernelsCountForParallelZebinDecode);
+    EXPECT_LE(workersCount, static_cast<uint32_t>(NEO::minKernelsCountForParallelZebinDecode / NEO::minKernelsCountPerZebinDecodeWorker));
+    EXPECT_LE(NEO::getZebinDecodeWorkersCount(100000U), NEO::maxZebinDecodeWorkersCount);
+}
+
+TEST(AcquireZebinDecodeHelperThreads, GivenHelpersInUseThenOnlyRemainingHelpersAreGranted) {
+    constexpr auto maxHelpers = NEO::maxZebinDecodeWorkersCount - 1;
+    auto first = NEO::acquireZebinDecodeHelperThreads(maxHelpers);
+    EXPECT_EQ(maxHelpers, first);
+    EXPECT_EQ(0U, NEO::acquireZebinDecodeHelperThreads(1U));
+
+    NEO::releaseZebinDecodeHelperThreads(1U);
+    EXPECT_EQ(1U, NEO::acquireZebinDecodeHelperThreads(maxHelpers));
+    NEO::releaseZebinDecodeHelperThreads(maxHelpers);
+}
+
+TEST(GetZebinDecodeWorkersCount, GivenDebugFlagThenUseRequestedWorkersCountLimitedByKernelsCount) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.ZebinDecodeWorkerThreads.set(4);
+    EXPECT_EQ(4U, NEO::getZebinDecodeWorkersCount(10U));
+    EXPECT_EQ(2U, NEO::getZebinDecodeWorkersCount(2U));
+
+    NEO::DebugManager.flags.ZebinDecodeWorkerThreads.set(0);
+    EXPECT_EQ(1U, NEO::getZebinDecodeWorkersCount(NEO::minKernelsCountForParallelZebinDecode));
+}
+
+TEST(PopulateKernelDescriptors, GivenMultipleWorkersThenKernelsAndMessagesAreInSameOrderAsWhenDecodedSequentially) {
+    constexpr int numKernels = 8;
+    std::string zeinfo = "kernels:\n";
+    ZebinTestData::ValidEmptyProgram zebin;
+    for (int i = 0; i < numKernels; ++i) {
+        auto kernelName = "kernel_" + std::to_string(i);
+        zeinfo += "    - name : " + kernelName + "\n";
+        zeinfo += "      execution_env:\n";
+        zeinfo += "        simd_size: " + std::string((i == 5) ? "7" : "8") + "\n";
+        zeinfo += "      unknown_entry_" + std::to_string(i) + ": 0\n";
+        zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + kernelName, {});
+    }
+
+    std::string errors, warnings;
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::Yaml::YamlParser parser;
+    bool parseSuccess = parser.parse(zeinfo, errors, warnings);
+    ASSERT_TRUE(parseSuccess) << errors << " " << warnings;
+
+    NEO::ZebinSections zebinSections;
+    auto extractErr = NEO::extractZebinSections(elf, zebinSections, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::Success, extractErr) << errors << " " << warnings;
+
+    auto &kernelsNode = *parser.findNodeWithKeyDfs("kernels");
+
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.ZebinDecodeWorkerThreads.set(1);
+    NEO::ProgramInfo sequentialProgramInfo;
+    std::string sequentialErrors, sequentialWarnings;
+    auto sequentialErr = NEO::populateKernelDescriptors(sequentialProgramInfo, elf, zebinSections, parser, kernelsNode, sequentialErrors, sequentialWarnings);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, sequentialErr);
+    ASSERT_EQ(5U, sequentialProgramInfo.kernelInfos.size());
+
+    NEO::DebugManager.flags.ZebinDecodeWorkerThreads.set(4);
+    NEO::ProgramInfo parallelProgramInfo;
+    std::string parallelErrors, parallelWarnings;
+    auto parallelErr = NEO::populateKernelDescriptors(parallelProgramInfo, elf, zebinSections, parser, kernelsNode, parallelErrors, parallelWarnings);
+    EXPECT_EQ(sequentialErr, parallelErr);
+    EXPECT_EQ(sequentialErrors, parallelErrors);
+    EXPECT_EQ(sequentialWarnings, parallelWarnings);
+    ASSERT_EQ(sequentialProgramInfo.kernelInfos.size(), parallelProgramInfo.kernelInfos.size());
+    for (size_t i = 0; i < parallelProgramInfo.kernelInfos.size(); ++i) {
+        EXPECT_EQ("kernel_" + std::to_string(i), parallelProgramInfo.kernelInfos[i]->kernelDescriptor.kernelMetadata.kernelName);
+    }
+}
+
 TEST(ReadZeInfoExecutionEnvironment, GivenValidYamlEntriesThenSetProperMembers) {
     NEO::ConstStringRef yaml = R"===(---
 kernels:         
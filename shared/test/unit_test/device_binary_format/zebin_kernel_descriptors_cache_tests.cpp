@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/device_binary_format/elf/zebin_elf.h"
+#include "shared/source/device_binary_format/zebin_kernel_descriptors_cache.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/device_binary_format/zebin_tests.h"
+
+#include "opencl/source/program/kernel_info.h"
+#include "test.h"
+
+#include <vector>
+
+namespace {
+struct ZebinWithKernel : ZebinTestData::ValidEmptyProgram {
+    ZebinWithKernel() {
+        std::string zeInfo = std::string{"---\nversion : \'" + toString(NEO::zeInfoDecoderVersion) + "\'" + R"===(
+kernels:
+    - name : some_kernel
+      execution_env:
+        simd_size: 8
+        grf_count: 128
+      payload_arguments:
+        - arg_type:        arg_bypointer
+          offset:          0
+          size:            8
+          arg_index:       0
+          addrmode : stateful
+        - arg_type:        arg_byvalue
+          offset:          8
+          size:            4
+          arg_index:       1
+        - arg_type:        local_size
+          offset:          16
+          size:            12
+      binding_table_indices:
+        - arg_index: 0
+          bti_value: 2
+...
+)==="};
+        removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+        appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(zeInfo.data(), zeInfo.size()));
+        appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", kernelIsa);
+    }
+
+    const uint8_t kernelIsa[8] = {2, 3, 5, 7, 11, 13, 17, 19};
+};
+
+NEO::SingleDeviceBinary toSingleDeviceBinary(const std::vector<uint8_t> &storage) {
+    NEO::SingleDeviceBinary binary = {};
+    binary.deviceBinary = storage;
+    binary.targetDevice.grfSize = 32U;
+    return binary;
+}
+} // namespace
+
+TEST(ZebinKernelDescriptorsCache, GivenSameBinaryThenCacheEntryNameIsTheSameAndDiffersForOtherBinaries) {
+    ZebinWithKernel zebin;
+    ZebinTestData::ValidEmptyProgram emptyZebin;
+    auto entryName = NEO::ZebinKernelDescriptorsCache::getCacheEntryName(zebin.storage);
+    EXPECT_FALSE(entryName.empty());
+    EXPECT_EQ(entryName, NEO::ZebinKernelDescriptorsCache::getCacheEntryName(zebin.storage));
+    EXPECT_NE(entryName, NEO::ZebinKernelDescriptorsCache::getCacheEntryName(emptyZebin.storage));
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenZebinAppendElwsWhenGettingCacheEntryNameThenItDiffersFromDefaultOne) {
+    DebugManagerStateRestore restorer;
+    ZebinWithKernel zebin;
+    auto entryName = NEO::ZebinKernelDescriptorsCache::getCacheEntryName(zebin.storage);
+
+    NEO::DebugManager.flags.ZebinAppendElws.set(true);
+    EXPECT_NE(entryName, NEO::ZebinKernelDescriptorsCache::getCacheEntryName(zebin.storage));
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenSerializedProgramInfoWhenDeserializingThenKernelDescriptorsMatchDecodedOnes) {
+    ZebinWithKernel zebin;
+    auto binary = toSingleDeviceBinary(zebin.storage);
+
+    NEO::ProgramInfo decoded;
+    std::string errors, warnings;
+    auto decodeError = NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(decoded, binary, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::Success, decodeError) << errors;
+    ASSERT_EQ(1U, decoded.kernelInfos.size());
+
+    std::vector<uint8_t> serialized;
+    ASSERT_TRUE(NEO::ZebinKernelDescriptorsCache::serialize(decoded, zebin.storage, "", serialized));
+
+    NEO::ProgramInfo cached;
+    auto cacheError = NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, serialized, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::Success, cacheError) << errors;
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_EQ(1U, cached.kernelInfos.size());
+    EXPECT_EQ(decoded.grfSize, cached.grfSize);
+    EXPECT_NE(nullptr, cached.decodedElf.elfFileHeader);
+
+    const auto &expected = decoded.kernelInfos[0]->kernelDescriptor;
+    const auto &got = cached.kernelInfos[0]->kernelDescriptor;
+    EXPECT_EQ(expected.kernelMetadata.kernelName, got.kernelMetadata.kernelName);
+    EXPECT_EQ(expected.kernelAttributes.simdSize, got.kernelAttributes.simdSize);
+    EXPECT_EQ(expected.kernelAttributes.numGrfRequired, got.kernelAttributes.numGrfRequired);
+    EXPECT_EQ(expected.kernelAttributes.crossThreadDataSize, got.kernelAttributes.crossThreadDataSize);
+    EXPECT_EQ(expected.kernelAttributes.bufferAddressingMode, got.kernelAttributes.bufferAddressingMode);
+    EXPECT_EQ(0, memcmp(expected.payloadMappings.dispatchTraits.localWorkSize, got.payloadMappings.dispatchTraits.localWorkSize, sizeof(got.payloadMappings.dispatchTraits.localWorkSize)));
+    EXPECT_EQ(expected.payloadMappings.bindingTable.numEntries, got.payloadMappings.bindingTable.numEntries);
+    EXPECT_EQ(expected.payloadMappings.bindingTable.tableOffset, got.payloadMappings.bindingTable.tableOffset);
+
+    ASSERT_EQ(2U, got.payloadMappings.explicitArgs.size());
+    EXPECT_EQ(expected.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().bindful, got.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().bindful);
+    EXPECT_EQ(expected.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().stateless, got.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>().stateless);
+    ASSERT_EQ(1U, got.payloadMappings.explicitArgs[1].as<NEO::ArgDescValue>().elements.size());
+    EXPECT_EQ(8U, got.payloadMappings.explicitArgs[1].as<NEO::ArgDescValue>().elements[0].offset);
+    EXPECT_EQ(4U, got.payloadMappings.explicitArgs[1].as<NEO::ArgDescValue>().elements[0].size);
+
+    const auto &expectedHeaps = decoded.kernelInfos[0]->heapInfo;
+    const auto &gotHeaps = cached.kernelInfos[0]->heapInfo;
+    ASSERT_EQ(sizeof(zebin.kernelIsa), gotHeaps.KernelHeapSize);
+    EXPECT_EQ(0, memcmp(zebin.kernelIsa, gotHeaps.pKernelHeap, sizeof(zebin.kernelIsa)));
+    ASSERT_EQ(expectedHeaps.SurfaceStateHeapSize, gotHeaps.SurfaceStateHeapSize);
+    ASSERT_NE(nullptr, gotHeaps.pSsh);
+    EXPECT_EQ(0, memcmp(expectedHeaps.pSsh, gotHeaps.pSsh, gotHeaps.SurfaceStateHeapSize));
+    EXPECT_EQ(expectedHeaps.DynamicStateHeapSize, gotHeaps.DynamicStateHeapSize);
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenEntryFromDifferentBinaryOrGrfSizeWhenDeserializingThenFailAndKeepProgramInfoIntact) {
+    ZebinWithKernel zebin;
+    auto binary = toSingleDeviceBinary(zebin.storage);
+
+    NEO::ProgramInfo decoded;
+    std::string errors, warnings;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(decoded, binary, errors, warnings)) << errors;
+    std::vector<uint8_t> serialized;
+    ASSERT_TRUE(NEO::ZebinKernelDescriptorsCache::serialize(decoded, zebin.storage, "", serialized));
+
+    ZebinTestData::ValidEmptyProgram otherZebin;
+    auto otherBinary = toSingleDeviceBinary(otherZebin.storage);
+    NEO::ProgramInfo cached;
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, otherBinary, serialized, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+    EXPECT_FALSE(errors.empty());
+
+    auto otherGrfBinary = binary;
+    otherGrfBinary.targetDevice.grfSize = 64U;
+    errors.clear();
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, otherGrfBinary, serialized, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+    EXPECT_FALSE(errors.empty());
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenOutdatedOrCorruptedEntryWhenDeserializingThenFail) {
+    ZebinWithKernel zebin;
+    auto binary = toSingleDeviceBinary(zebin.storage);
+
+    NEO::ProgramInfo decoded;
+    std::string errors, warnings;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(decoded, binary, errors, warnings)) << errors;
+    std::vector<uint8_t> serialized;
+    ASSERT_TRUE(NEO::ZebinKernelDescriptorsCache::serialize(decoded, zebin.storage, "", serialized));
+
+    auto outdated = serialized;
+    reinterpret_cast<NEO::ZebinKernelDescriptorsCache::Header *>(outdated.data())->version = NEO::ZebinKernelDescriptorsCache::version + 1;
+    NEO::ProgramInfo cached;
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, outdated, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+
+    auto otherDriver = serialized;
+    reinterpret_cast<NEO::ZebinKernelDescriptorsCache::Header *>(otherDriver.data())->driverFingerprint = NEO::ZebinKernelDescriptorsCache::getDriverFingerprint() + 1;
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, otherDriver, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+
+    auto truncated = serialized;
+    truncated.resize(truncated.size() - 1);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, truncated, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+
+    auto withTrailingData = serialized;
+    withTrailingData.push_back(0U);
+    EXPECT_EQ(NEO::DecodeError::InvalidBinary, NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, withTrailingData, errors, warnings));
+    EXPECT_TRUE(cached.kernelInfos.empty());
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenDecodeWarningsWhenDeserializingThenStoredWarningsAreReplayed) {
+    ZebinWithKernel zebin;
+    auto binary = toSingleDeviceBinary(zebin.storage);
+
+    NEO::ProgramInfo decoded;
+    std::string errors, warnings;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(decoded, binary, errors, warnings)) << errors;
+    std::vector<uint8_t> serialized;
+    ASSERT_TRUE(NEO::ZebinKernelDescriptorsCache::serialize(decoded, zebin.storage, warnings + "DeviceBinaryFormat::Zebin : Unknown entry\n", serialized));
+
+    NEO::ProgramInfo cached;
+    std::string cacheWarnings;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::ZebinKernelDescriptorsCache::deserialize(cached, binary, serialized, errors, cacheWarnings)) << errors;
+    EXPECT_EQ(warnings + "DeviceBinaryFormat::Zebin : Unknown entry\n", cacheWarnings);
+}
+
+TEST(ZebinKernelDescriptorsCache, GivenKernelWithPrintfStringsThenSerializationIsRefused) {
+    ZebinWithKernel zebin;
+    auto binary = toSingleDeviceBinary(zebin.storage);
+
+    NEO::ProgramInfo decoded;
+    std::string errors, warnings;
+    ASSERT_EQ(NEO::DecodeError::Success, NEO::decodeSingleDeviceBinary<NEO::DeviceBinaryFormat::Zebin>(decoded, binary, errors, warnings)) << errors;
+    decoded.kernelInfos[0]->kernelDescriptor.kernelMetadata.printfStringsMap[0] = "%d";
+
+    std::vector<uint8_t> serialized;
+    EXPECT_FALSE(NEO::ZebinKernelDescriptorsCache::serialize(decoded, zebin.storage, "", serialized));
+}
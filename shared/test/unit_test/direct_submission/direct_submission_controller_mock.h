@@ -11,11 +11,45 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::adaptiveTimeout;
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::condVar;
+    using DirectSubmissionController::condVarMutex;
+    using DirectSubmissionController::controllerSleeping;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
+    using DirectSubmissionController::getCheckPeriod;
     using DirectSubmissionController::keepControlling;
+    using DirectSubmissionController::minTimeout;
+    using DirectSubmissionController::restartedOsContexts;
+    using DirectSubmissionController::ringStartPending;
+    using DirectSubmissionController::SteadyClock;
     using DirectSubmissionController::timeout;
+    using DirectSubmissionController::waitForActiveDirectSubmission;
+
+    void stopControlling() {
+        keepControlling.store(false);
+        {
+            std::lock_guard<std::mutex> lock(condVarMutex);
+            condVar.notify_all();
+        }
+        directSubmissionControllingThread.join();
+        keepControlling.store(true);
+    }
+
+    SteadyClock::time_point getCpuTimestamp() override {
+        if (useMockTimestamp) {
+            return cpuTimestamp;
+        }
+        return DirectSubmissionController::getCpuTimestamp();
+    }
+
+    void advanceTime(std::chrono::microseconds delta) {
+        cpuTimestamp += delta;
+    }
+
+    SteadyClock::time_point cpuTimestamp = SteadyClock::time_point{} + std::chrono::seconds(1);
+    std::atomic_bool useMockTimestamp = false;
 };
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
@@ -6,10 +6,13 @@
  */
 
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/unit_test/direct_submission/direct_submission_controller_mock.h"
 
+#include "opencl/test/unit_test/mocks/mock_os_context.h"
+
 #include "test.h"
 
 namespace NEO {
@@ -23,6 +26,37 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerTimeoutWhen
     EXPECT_EQ(controller.timeout, 14);
 }
 
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCreateObjectThenAdaptiveTimeoutIsEnabledByDefault) {
+    DirectSubmissionControllerMock controller;
+
+    EXPECT_TRUE(controller.adaptiveTimeout);
+    EXPECT_EQ(controller.minTimeout, 1);
+    EXPECT_EQ(controller.getCheckPeriod(), std::chrono::milliseconds(1));
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutDebugFlagsWhenCreateObjectThenSettingsAreEqualWithDebugFlags) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerTimeout.set(14);
+    DebugManager.flags.DirectSubmissionControllerMinTimeout.set(3);
+    DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(0);
+
+    DirectSubmissionControllerMock controller;
+
+    EXPECT_FALSE(controller.adaptiveTimeout);
+    EXPECT_EQ(controller.minTimeout, 3);
+    EXPECT_EQ(controller.getCheckPeriod(), std::chrono::milliseconds(14));
+}
+
+TEST(DirectSubmissionControllerTests, givenMinTimeoutGreaterThanTimeoutWhenCreateObjectThenMinTimeoutIsLimitedToTimeout) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerTimeout.set(2);
+    DebugManager.flags.DirectSubmissionControllerMinTimeout.set(3);
+
+    DirectSubmissionControllerMock controller;
+
+    EXPECT_EQ(controller.minTimeout, 2);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegisterDirectSubmissionWorksThenItIsMonitoringItsState) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.prepareRootDeviceEnvironments(1);
@@ -35,29 +69,34 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr.taskCount.store(5u);
 
     DirectSubmissionControllerMock controller;
-    controller.keepControlling.store(false);
-    controller.directSubmissionControllingThread.join();
+    controller.stopControlling();
+    controller.useMockTimestamp = true;
+    controller.adaptiveTimeout = false;
     controller.registerDirectSubmission(&csr);
+    auto timeout = std::chrono::milliseconds(controller.timeout);
 
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
-    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 0u);
+    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
 
-    *csr.tagAddress = 5u;
+    controller.advanceTime(timeout);
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
 
+    *csr.tagAddress = 5u;
     csr.taskCount.store(6u);
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
-    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 5u);
+    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
     *csr.tagAddress = 6u;
+    controller.advanceTime(timeout - std::chrono::microseconds(1));
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
 
+    controller.advanceTime(std::chrono::microseconds(1));
     controller.checkNewSubmissions();
     EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
     EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
@@ -69,11 +108,212 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     csr.taskCount.store(8u);
     controller.checkNewSubmissions();
     EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
-    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 6u);
+    EXPECT_EQ(controller.directSubmissions[&csr].taskCount, 8u);
 
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutWhenSubmissionsArriveFrequentlyThenTimeoutIsShortenedToMultipleOfInterArrivalTime) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.initializeTagAllocation();
+    *csr.tagAddress = 0u;
+    csr.taskCount.store(0u);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.useMockTimestamp = true;
+    controller.timeout = 10;
+    controller.minTimeout = 1;
+    controller.registerDirectSubmission(&csr);
+    auto &state = controller.directSubmissions[&csr];
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(10)), state.timeout);
+
+    csr.taskCount.store(1u);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(10)), state.timeout);
+
+    for (uint32_t taskCount = 3u; taskCount <= 9u; taskCount += 2) {
+        controller.advanceTime(std::chrono::microseconds(1000));
+        csr.taskCount.store(taskCount);
+        controller.checkNewSubmissions();
+        EXPECT_EQ(std::chrono::microseconds(500), state.averageInterArrival);
+        EXPECT_EQ(std::chrono::microseconds(500 * DirectSubmissionController::adaptiveTimeoutMultiplier), state.timeout);
+    }
+
+    *csr.tagAddress = 9u;
+    controller.advanceTime(state.timeout - std::chrono::microseconds(1));
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(state.isStopped);
+
+    controller.advanceTime(std::chrono::microseconds(1));
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(state.isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutWhenSubmissionsArriveRarelyThenMinTimeoutIsUsed) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.initializeTagAllocation();
+    *csr.tagAddress = 0u;
+    csr.taskCount.store(1u);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.useMockTimestamp = true;
+    controller.timeout = 5;
+    controller.minTimeout = 1;
+    controller.registerDirectSubmission(&csr);
+    auto &state = controller.directSubmissions[&csr];
+
+    controller.checkNewSubmissions();
+    controller.advanceTime(std::chrono::milliseconds(20));
+    csr.taskCount.store(2u);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(20)), state.averageInterArrival);
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(1)), state.timeout);
+
+    controller.advanceTime(std::chrono::milliseconds(20));
+    csr.taskCount.store(3u);
+    controller.checkNewSubmissions();
+    EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(1)), state.timeout);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutDisabledWhenSubmissionsArriveFrequentlyThenTimeoutIsNotChanged) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.initializeTagAllocation();
+    *csr.tagAddress = 0u;
+    csr.taskCount.store(1u);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.useMockTimestamp = true;
+    controller.adaptiveTimeout = false;
+    controller.registerDirectSubmission(&csr);
+    auto &state = controller.directSubmissions[&csr];
+
+    for (uint32_t taskCount = 2u; taskCount <= 5u; taskCount++) {
+        controller.advanceTime(std::chrono::microseconds(100));
+        csr.taskCount.store(taskCount);
+        controller.checkNewSubmissions();
+        EXPECT_EQ(std::chrono::microseconds(std::chrono::milliseconds(controller.timeout)), state.timeout);
+    }
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenAllDirectSubmissionsStoppedWhenRingStartIsNotifiedThenControllerWakesUpAndMonitorsDirectSubmissions) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.initializeTagAllocation();
+
+    MockOsContext osContext(0, EngineDescriptorHelper::getDefaultDescriptor());
+    csr.setupContext(osContext);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.registerDirectSubmission(&csr);
+    EXPECT_TRUE(controller.ringStartPending.load());
+    controller.directSubmissions[&csr].isStopped = true;
+
+    controller.notifyRingStarted(osContext);
+    EXPECT_TRUE(controller.waitForActiveDirectSubmission());
+    EXPECT_FALSE(controller.ringStartPending.load());
+    EXPECT_FALSE(controller.controllerSleeping.load());
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenTwoStoppedDirectSubmissionsWhenOneRingStartIsNotifiedThenOnlyThatDirectSubmissionIsActive) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver restartedCsr(executionEnvironment, 0, deviceBitfield);
+    MockCommandStreamReceiver idleCsr(executionEnvironment, 0, deviceBitfield);
+    restartedCsr.initializeTagAllocation();
+    idleCsr.initializeTagAllocation();
+    MockOsContext restartedOsContext(0, EngineDescriptorHelper::getDefaultDescriptor());
+    MockOsContext idleOsContext(1, EngineDescriptorHelper::getDefaultDescriptor());
+    restartedCsr.setupContext(restartedOsContext);
+    idleCsr.setupContext(idleOsContext);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.registerDirectSubmission(&restartedCsr);
+    controller.registerDirectSubmission(&idleCsr);
+    controller.directSubmissions[&restartedCsr].isStopped = true;
+    controller.directSubmissions[&idleCsr].isStopped = true;
+
+    controller.notifyRingStarted(restartedOsContext);
+    EXPECT_TRUE(controller.waitForActiveDirectSubmission());
+    EXPECT_FALSE(controller.directSubmissions[&restartedCsr].isStopped);
+    EXPECT_TRUE(controller.directSubmissions[&idleCsr].isStopped);
+
+    controller.unregisterDirectSubmission(&restartedCsr);
+    controller.unregisterDirectSubmission(&idleCsr);
+}
+
+TEST(DirectSubmissionControllerTests, givenRepeatedRingStartNotificationsWhenCheckingNewSubmissionsThenRestartedContextIsListedOnceAndDrained) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.initializeTagAllocation();
+    MockOsContext osContext(0, EngineDescriptorHelper::getDefaultDescriptor());
+    csr.setupContext(osContext);
+
+    DirectSubmissionControllerMock controller;
+    controller.stopControlling();
+    controller.registerDirectSubmission(&csr);
+    controller.directSubmissions[&csr].isStopped = true;
+
+    controller.notifyRingStarted(osContext);
+    controller.notifyRingStarted(osContext);
+    controller.notifyRingStarted(osContext);
+    EXPECT_EQ(1u, controller.restartedOsContexts.size());
+
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.restartedOsContexts.empty());
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenNoActiveDirectSubmissionWhenControllerIsDestroyedThenSleepingControllerThreadIsWokenUp) {
+    DirectSubmissionControllerMock controller;
+
+    while (!controller.controllerSleeping.load()) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(controller.directSubmissionControllingThread.joinable());
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenTimeoutThenDirectSubmissionsAreChecked) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.prepareRootDeviceEnvironments(1);
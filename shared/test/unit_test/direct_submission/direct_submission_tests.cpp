@@ -138,8 +138,9 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsStarted
     EXPECT_TRUE(ret);
     EXPECT_TRUE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_NE(0u, directSubmission.ringCommandStream.getUsed());
@@ -153,44 +154,169 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsNotStar
     EXPECT_TRUE(ret);
     EXPECT_FALSE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_EQ(0u, directSubmission.ringCommandStream.getUsed());
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsPrimaryThenExpectNextSecondary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsSecondaryThenExpectNextPrimary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 
     nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer, nextRing);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 }
+HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenAllRingBuffersAreBusyThenExpectNewRingBufferAllocated) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(2u, directSubmission.ringStatistics.ringAllocations);
+
+    directSubmission.isCompletedReturn = false;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    ASSERT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[2].ringBuffer, nextRing);
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.previousRingBuffer);
+    EXPECT_EQ(0ull, directSubmission.ringBuffers[2].completionFence);
+
+    EXPECT_EQ(1u, directSubmission.ringStatistics.ringSwitches);
+    EXPECT_EQ(0u, directSubmission.ringStatistics.ringStalls);
+    EXPECT_EQ(3u, directSubmission.ringStatistics.ringAllocations);
+}
+
+HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenOnlyOneRingBufferIsCompletedThenExpectCompletedRingBufferSelected) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+
+    directSubmission.isCompletedReturn = true;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(2u, directSubmission.previousRingBuffer);
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+}
+
+HWTEST_F(DirectSubmissionTest, givenMaxRingBufferCountReachedWhenAllRingBuffersAreBusyThenExpectNextRingBufferReusedAndStallCounted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(2);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(2u, directSubmission.maxRingBufferCount);
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+
+    directSubmission.isCompletedReturn = false;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(1u, directSubmission.ringStatistics.ringStalls);
+    EXPECT_EQ(2u, directSubmission.ringStatistics.ringAllocations);
+}
+
+HWTEST_F(DirectSubmissionTest, givenMaxRingBufferDebugFlagBelowInitialCountWhenCreatingDirectSubmissionThenExpectInitialCountUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(1);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(2u, directSubmission.maxRingBufferCount);
+}
+
+HWTEST_F(DirectSubmissionTest, givenRingBufferFilledFasterThanGrowthThresholdWhenNewRingBufferIsAllocatedThenExpectBiggerRingBuffer) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionRingBufferGrowthThreshold.set(1000000);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+    size_t initialRingBufferSize = directSubmission.ringBufferSize;
+    EXPECT_EQ(initialRingBufferSize, directSubmission.ringCommandStream.getMaxAvailableSpace());
+
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffers();
+    ASSERT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(2 * initialRingBufferSize, directSubmission.ringBufferSize);
+    EXPECT_EQ(2 * initialRingBufferSize, directSubmission.ringBuffers[2].size);
+    EXPECT_EQ(2 * initialRingBufferSize, directSubmission.ringCommandStream.getMaxAvailableSpace());
+    EXPECT_EQ(directSubmission.ringBuffers[2].ringBuffer, directSubmission.ringCommandStream.getGraphicsAllocation());
+
+    directSubmission.ringBufferSize = directSubmission.maxRingBufferSize;
+    directSubmission.switchRingBuffers();
+    EXPECT_EQ(directSubmission.maxRingBufferSize, directSubmission.ringBufferSize);
+}
+
+HWTEST_F(DirectSubmissionTest, givenRingBufferGrowthDisabledWhenNewRingBufferIsAllocatedThenExpectRingBufferSizeUnchanged) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionRingBufferGrowthThreshold.set(0);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+    size_t initialRingBufferSize = directSubmission.ringBufferSize;
+
+    directSubmission.isCompletedReturn = false;
+    directSubmission.switchRingBuffers();
+    ASSERT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(initialRingBufferSize, directSubmission.ringBufferSize);
+    EXPECT_EQ(initialRingBufferSize, directSubmission.ringBuffers[2].size);
+}
+
+HWTEST_F(DirectSubmissionTest, givenPrintRingStatisticsFlagWhenDirectSubmissionIsDestroyedThenExpectStatisticsPrinted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.PrintDirectSubmissionRingStatistics.set(true);
+
+    testing::internal::CaptureStdout();
+    {
+        MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                          *osContext.get());
+        bool ret = directSubmission.initialize(false);
+        EXPECT_TRUE(ret);
+        directSubmission.switchRingBuffersAllocations();
+    }
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Direct submission ring statistics: submissions: 0, ring switches: 1, ring stalls: 0, ring allocations: 2"));
+}
+
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionAllocateFailWhenRingIsStartedThenExpectRingNotStarted) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
@@ -729,8 +855,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     bool ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffer;
-    directSubmission->ringBuffer = nullptr;
+    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffers[0].ringBuffer;
+    directSubmission->ringBuffers[0].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -740,8 +866,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    nulledAllocation = directSubmission->ringBuffer2;
-    directSubmission->ringBuffer2 = nullptr;
+    nulledAllocation = directSubmission->ringBuffers[1].ringBuffer;
+    directSubmission->ringBuffers[1].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -57,7 +57,9 @@ struct MockDrmDirectSubmission : public DrmDirectSubmission<GfxFamily, Dispatche
     using BaseClass::getTagAddressValue;
     using BaseClass::handleNewResourcesSubmission;
     using BaseClass::handleResidency;
+    using BaseClass::isCompleted;
     using BaseClass::isNewResourceHandleNeeded;
+    using BaseClass::ringBuffers;
     using BaseClass::ringStart;
     using BaseClass::submit;
     using BaseClass::switchRingBuffers;
@@ -156,6 +158,23 @@ HWTEST_F(DrmDirectSubmissionTest, givenDisabledMonitorFenceWhenUpdateTagValueThe
     directSubmission.currentTagData.tagValue--;
 }
 
+HWTEST_F(DrmDirectSubmissionTest, givenRingBufferCompletionFenceWhenCheckingRingBufferCompletionThenCompareWithTagValue) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDrmDirectSubmission<FamilyType, Dispatcher> directSubmission(*device.get(),
+                                                                     *osContext.get());
+
+    bool ret = directSubmission.allocateResources();
+    EXPECT_TRUE(ret);
+
+    *directSubmission.tagAddress = 2u;
+    directSubmission.ringBuffers[1].completionFence = 2u;
+    EXPECT_TRUE(directSubmission.isCompleted(1u));
+
+    directSubmission.ringBuffers[1].completionFence = 3u;
+    EXPECT_FALSE(directSubmission.isCompleted(1u));
+}
+
 HWTEST_F(DrmDirectSubmissionTest, whenCheckForDirectSubmissionSupportThenProperValueIsReturned) {
     auto directSubmissionSupported = osContext->isDirectSubmissionSupported(device->getHardwareInfo());
 
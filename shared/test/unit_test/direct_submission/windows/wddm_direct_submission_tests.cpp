@@ -55,8 +55,8 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenDirectIsInitializedAndStartedThe
     bool ret = wddmDirectSubmission->initialize(true);
     EXPECT_TRUE(ret);
     EXPECT_TRUE(wddmDirectSubmission->ringStart);
-    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffer);
-    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffer2);
+    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, wddmDirectSubmission->semaphores);
 
     EXPECT_EQ(1u, wddm->makeResidentResult.called);
@@ -69,7 +69,7 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenDirectIsInitializedAndStartedThe
     EXPECT_NE(0u, wddmDirectSubmission->ringCommandStream.getUsed());
 
     *wddmDirectSubmission->ringFence.cpuAddress = 1ull;
-    wddmDirectSubmission->completionRingBuffers[wddmDirectSubmission->currentRingBuffer] = 2ull;
+    wddmDirectSubmission->ringBuffers[wddmDirectSubmission->currentRingBuffer].completionFence = 2ull;
 
     wddmDirectSubmission.reset(nullptr);
     EXPECT_EQ(1u, wddm->waitFromCpuResult.called);
@@ -87,8 +87,8 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenDirectIsInitializedAndNotStarted
     bool ret = wddmDirectSubmission->initialize(false);
     EXPECT_TRUE(ret);
     EXPECT_FALSE(wddmDirectSubmission->ringStart);
-    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffer);
-    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffer2);
+    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, wddmDirectSubmission->ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, wddmDirectSubmission->semaphores);
 
     EXPECT_EQ(1u, wddm->makeResidentResult.called);
@@ -231,14 +231,14 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferStartedThenEx
     bool ret = wddmDirectSubmission.initialize(true);
     EXPECT_TRUE(ret);
     size_t usedSpace = wddmDirectSubmission.ringCommandStream.getUsed();
-    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffer->getGpuAddress() + usedSpace;
+    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffers[0].ringBuffer->getGpuAddress() + usedSpace;
 
     uint64_t gpuVa = wddmDirectSubmission.switchRingBuffers();
     EXPECT_EQ(expectedGpuVa, gpuVa);
-    EXPECT_EQ(wddmDirectSubmission.ringBuffer2, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[1].ringBuffer, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
 
     LinearStream tmpCmdBuffer;
-    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffer->getUnderlyingBuffer(),
+    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffers[0].ringBuffer->getUnderlyingBuffer(),
                                wddmDirectSubmission.ringCommandStream.getMaxAvailableSpace());
     tmpCmdBuffer.getSpace(usedSpace + wddmDirectSubmission.getSizeSwitchRingBufferSection());
     HardwareParse hwParse;
@@ -246,7 +246,7 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferStartedThenEx
     MI_BATCH_BUFFER_START *bbStart = hwParse.getCommand<MI_BATCH_BUFFER_START>();
     ASSERT_NE(nullptr, bbStart);
     uint64_t actualGpuVa = GmmHelper::canonize(bbStart->getBatchBufferStartAddressGraphicsaddress472());
-    EXPECT_EQ(wddmDirectSubmission.ringBuffer2->getGpuAddress(), actualGpuVa);
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[1].ringBuffer->getGpuAddress(), actualGpuVa);
 }
 
 HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferNotStartedThenExpectNoSwitchCommandsLinearStreamUpdated) {
@@ -260,14 +260,14 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferNotStartedThe
     size_t usedSpace = wddmDirectSubmission.ringCommandStream.getUsed();
     EXPECT_EQ(0u, usedSpace);
 
-    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffer->getGpuAddress();
+    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffers[0].ringBuffer->getGpuAddress();
 
     uint64_t gpuVa = wddmDirectSubmission.switchRingBuffers();
     EXPECT_EQ(expectedGpuVa, gpuVa);
-    EXPECT_EQ(wddmDirectSubmission.ringBuffer2, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[1].ringBuffer, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
 
     LinearStream tmpCmdBuffer;
-    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffer->getUnderlyingBuffer(),
+    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffers[0].ringBuffer->getUnderlyingBuffer(),
                                wddmDirectSubmission.ringCommandStream.getMaxAvailableSpace());
     HardwareParse hwParse;
     hwParse.parseCommands<FamilyType>(tmpCmdBuffer, 0u);
@@ -276,24 +276,26 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferNotStartedThe
 }
 
 HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferStartedAndWaitFenceUpdateThenExpectWaitCalled) {
-    using RingBufferUse = typename MockWddmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
     MockWddmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> wddmDirectSubmission(*device.get(),
                                                                                             *osContext.get());
+    wddmDirectSubmission.maxRingBufferCount = 2u;
 
     bool ret = wddmDirectSubmission.initialize(true);
     EXPECT_TRUE(ret);
     uint64_t expectedWaitFence = 0x10ull;
-    wddmDirectSubmission.completionRingBuffers[RingBufferUse::SecondBuffer] = expectedWaitFence;
+    MonitoredFence &contextFence = osContext->getResidencyController().getMonitoredFence();
+    *contextFence.cpuAddress = expectedWaitFence - 1;
+    wddmDirectSubmission.ringBuffers[1].completionFence = expectedWaitFence;
     size_t usedSpace = wddmDirectSubmission.ringCommandStream.getUsed();
-    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffer->getGpuAddress() + usedSpace;
+    uint64_t expectedGpuVa = wddmDirectSubmission.ringBuffers[0].ringBuffer->getGpuAddress() + usedSpace;
 
     uint64_t gpuVa = wddmDirectSubmission.switchRingBuffers();
     EXPECT_EQ(expectedGpuVa, gpuVa);
-    EXPECT_EQ(wddmDirectSubmission.ringBuffer2, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[1].ringBuffer, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
 
     LinearStream tmpCmdBuffer;
-    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffer->getUnderlyingBuffer(),
+    tmpCmdBuffer.replaceBuffer(wddmDirectSubmission.ringBuffers[0].ringBuffer->getUnderlyingBuffer(),
                                wddmDirectSubmission.ringCommandStream.getMaxAvailableSpace());
     tmpCmdBuffer.getSpace(usedSpace + wddmDirectSubmission.getSizeSwitchRingBufferSection());
     HardwareParse hwParse;
@@ -301,10 +303,32 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferStartedAndWai
     MI_BATCH_BUFFER_START *bbStart = hwParse.getCommand<MI_BATCH_BUFFER_START>();
     ASSERT_NE(nullptr, bbStart);
     uint64_t actualGpuVa = GmmHelper::canonize(bbStart->getBatchBufferStartAddressGraphicsaddress472());
-    EXPECT_EQ(wddmDirectSubmission.ringBuffer2->getGpuAddress(), actualGpuVa);
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[1].ringBuffer->getGpuAddress(), actualGpuVa);
 
     EXPECT_EQ(1u, wddm->waitFromCpuResult.called);
     EXPECT_EQ(expectedWaitFence, wddm->waitFromCpuResult.uint64ParamPassed);
+    EXPECT_EQ(1u, wddmDirectSubmission.ringStatistics.ringStalls);
+}
+
+HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenSwitchingRingBufferStartedAndAllRingBuffersBusyThenExpectNewRingBufferAllocatedWithoutWait) {
+    MockWddmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> wddmDirectSubmission(*device.get(),
+                                                                                            *osContext.get());
+
+    bool ret = wddmDirectSubmission.initialize(true);
+    EXPECT_TRUE(ret);
+    uint64_t expectedWaitFence = 0x10ull;
+    MonitoredFence &contextFence = osContext->getResidencyController().getMonitoredFence();
+    *contextFence.cpuAddress = expectedWaitFence - 1;
+    wddmDirectSubmission.ringBuffers[1].completionFence = expectedWaitFence;
+
+    wddmDirectSubmission.switchRingBuffers();
+    EXPECT_EQ(3u, wddmDirectSubmission.ringBuffers.size());
+    EXPECT_EQ(2u, wddmDirectSubmission.currentRingBuffer);
+    EXPECT_EQ(wddmDirectSubmission.ringBuffers[2].ringBuffer, wddmDirectSubmission.ringCommandStream.getGraphicsAllocation());
+
+    EXPECT_EQ(0u, wddm->waitFromCpuResult.called);
+    EXPECT_EQ(0u, wddmDirectSubmission.ringStatistics.ringStalls);
+    EXPECT_EQ(3u, wddmDirectSubmission.ringStatistics.ringAllocations);
 }
 
 HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenUpdatingTagValueThenExpectCompletionRingBufferUpdated) {
@@ -316,11 +340,12 @@ HWTEST_F(WddmDirectSubmissionTest, givenWddmWhenUpdatingTagValueThenExpectComple
 
     MockWddmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> wddmDirectSubmission(*device.get(),
                                                                                             *osContext.get());
+    EXPECT_TRUE(wddmDirectSubmission.initialize(false));
 
     uint64_t actualTagValue = wddmDirectSubmission.updateTagValue();
     EXPECT_EQ(value, actualTagValue);
     EXPECT_EQ(value + 1, contextFence.currentFenceValue);
-    EXPECT_EQ(value, wddmDirectSubmission.completionRingBuffers[wddmDirectSubmission.currentRingBuffer]);
+    EXPECT_EQ(value, wddmDirectSubmission.ringBuffers[wddmDirectSubmission.currentRingBuffer].completionFence);
 }
 
 HWTEST_F(WddmDirectSubmissionTest, givenWddmResidencyEnabledWhenCreatingDestroyingThenSubmitterNotifiesResidencyLogger) {
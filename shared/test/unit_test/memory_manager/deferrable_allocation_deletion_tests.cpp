@@ -170,3 +170,45 @@ TEST_F(DeferrableAllocationDeletionTest, givenAllocationUsedByUnregisteredEngine
     EXPECT_TRUE(deletion.apply());
     EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
 }
+
+TEST_F(DeferrableAllocationDeletionTest, givenTwoNotCompletedAllocationsWhenDeletionsAreAppliedInOneBatchThenCsrIsFlushedOnce) {
+    auto allocation1 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    *hwTag = 0u;
+    allocation1->updateTaskCount(1u, defaultOsContextId);
+    allocation2->updateTaskCount(2u, defaultOsContextId);
+    DeferrableAllocationDeletion deletion1{*memoryManager, *allocation1};
+    DeferrableAllocationDeletion deletion2{*memoryManager, *allocation2};
+
+    std::vector<CommandStreamReceiver *> flushedCsrs;
+    EXPECT_FALSE(deletion1.applyInBatch(flushedCsrs));
+    EXPECT_FALSE(deletion2.applyInBatch(flushedCsrs));
+    ASSERT_EQ(1u, flushedCsrs.size());
+    EXPECT_EQ(device->getDefaultEngine().commandStreamReceiver, flushedCsrs[0]);
+    EXPECT_EQ(0u, memoryManager->freeGraphicsMemoryCalled);
+
+    *hwTag = 2u;
+    flushedCsrs.clear();
+    EXPECT_TRUE(deletion1.applyInBatch(flushedCsrs));
+    EXPECT_TRUE(deletion2.applyInBatch(flushedCsrs));
+    EXPECT_EQ(0u, flushedCsrs.size());
+    EXPECT_EQ(2u, memoryManager->freeGraphicsMemoryCalled);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenDeferredAllocationDeletionWhenItIsReleasedThenDeferredSizeIsUpdated) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto allocationSize = allocation->getUnderlyingBufferSize();
+    *hwTag = 0u;
+    allocation->updateTaskCount(1u, defaultOsContextId);
+
+    DeferredDeleter deleter;
+    deleter.deferDeletion(new DeferrableAllocationDeletion(*memoryManager, *allocation));
+    EXPECT_EQ(allocationSize, deleter.getDeferredSize());
+    EXPECT_EQ(allocationSize, deleter.getPeakDeferredSize());
+
+    *hwTag = 1u;
+    deleter.drain(true);
+    EXPECT_EQ(0u, deleter.getDeferredSize());
+    EXPECT_EQ(allocationSize, deleter.getPeakDeferredSize());
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+}
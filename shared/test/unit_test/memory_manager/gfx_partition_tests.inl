@@ -10,11 +10,13 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
 #include "gtest/gtest.h"
 
 #include <mutex>
+#include <thread>
 
 static std::string mockCpuFlags;
 static void mockGetCpuFlagsFunc(std::string &cpuFlags) { cpuFlags = mockCpuFlags; }
@@ -402,6 +404,88 @@ TEST(GfxPartitionTest, givenInternalHeapWhenAllocatingSmallOrBigChunkThenAddress
     }
 }
 
+TEST(GfxPartitionTest, givenGpuVaMagazineSizeSetWhenAllocatingFromStandardHeapThenRangesAreTakenFromBatchAndReusedAfterFree) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.GpuVaMagazineSize.set(4);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1);
+
+    size_t sizeToAllocate = MemoryConstants::pageSize;
+    auto firstAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate);
+    EXPECT_NE(0ull, firstAddress);
+    EXPECT_EQ(MemoryConstants::pageSize64k, sizeToAllocate);
+
+    auto secondAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate);
+    EXPECT_EQ(firstAddress + MemoryConstants::pageSize64k, secondAddress);
+
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, firstAddress, sizeToAllocate);
+    EXPECT_EQ(firstAddress, gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate));
+
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, firstAddress, sizeToAllocate);
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, secondAddress, sizeToAllocate);
+}
+
+TEST(GfxPartitionTest, givenRangesCachedByOtherThreadWhenHeapIsExhaustedThenCachedRangesAreReturnedToHeap) {
+    const size_t rangesCount = 8;
+    const uint64_t heapBase = 0x100000000ull;
+    const size_t rangeSize = MemoryConstants::pageSize64k;
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.heapInitWithAllocationAlignment(HeapIndex::HEAP_STANDARD64KB, heapBase, (rangesCount + 2) * rangeSize, rangeSize);
+    gfxPartition.heapInitMagazines(HeapIndex::HEAP_STANDARD64KB, 4);
+
+    size_t sizeToAllocate = rangeSize;
+    auto mainThreadAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate);
+    EXPECT_NE(0ull, mainThreadAddress);
+
+    std::vector<uint64_t> otherThreadAddresses;
+    std::thread otherThread([&]() {
+        for (size_t i = 0; i < rangesCount; i++) {
+            size_t size = rangeSize;
+            otherThreadAddresses.push_back(gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, size));
+        }
+    });
+    otherThread.join();
+
+    ASSERT_EQ(rangesCount, otherThreadAddresses.size());
+    for (size_t i = 0; i < rangesCount - 1; i++) {
+        EXPECT_NE(0ull, otherThreadAddresses[i]);
+        EXPECT_NE(mainThreadAddress, otherThreadAddresses[i]);
+    }
+    EXPECT_EQ(0ull, otherThreadAddresses[rangesCount - 1]);
+}
+
+TEST(GfxPartitionTest, givenMagazinesHoldingFreeSpaceWhenBigAllocationDoesNotFitThenMagazinesAreDrainedAndAllocationSucceeds) {
+    const size_t rangesCount = 32;
+    const uint64_t heapBase = 0x100000000ull;
+    const size_t rangeSize = MemoryConstants::pageSize64k;
+    const size_t heapSize = rangesCount * rangeSize;
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.heapInitWithAllocationAlignment(HeapIndex::HEAP_STANDARD64KB, heapBase, heapSize + 2 * GfxPartition::heapGranularity, rangeSize);
+    gfxPartition.heapInitMagazines(HeapIndex::HEAP_STANDARD64KB, 4);
+
+    auto cacheRangeInMagazine = [&]() {
+        size_t sizeToAllocate = rangeSize;
+        auto address = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate);
+        EXPECT_NE(0ull, address);
+        gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, address, sizeToAllocate);
+    };
+
+    cacheRangeInMagazine();
+    size_t sizeToAllocate = heapSize;
+    auto address = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate);
+    EXPECT_EQ(heapBase + GfxPartition::heapGranularity, address);
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, address, sizeToAllocate);
+
+    cacheRangeInMagazine();
+    sizeToAllocate = heapSize;
+    address = gfxPartition.heapAllocateWithCustomAlignment(HeapIndex::HEAP_STANDARD64KB, sizeToAllocate, rangeSize);
+    EXPECT_EQ(heapBase + GfxPartition::heapGranularity, address);
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD64KB, address, sizeToAllocate);
+}
+
 using GfxPartitionTestForAllHeapTypes = ::testing::TestWithParam<HeapIndex>;
 
 TEST_P(GfxPartitionTestForAllHeapTypes, givenHeapIndexWhenFreeGpuAddressRangeIsCalledThenFreeMemory) {
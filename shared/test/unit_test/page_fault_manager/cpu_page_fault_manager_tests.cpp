@@ -689,3 +689,340 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     pageFaultManager->insertAllocation(allocs[3], 10, unifiedMemoryManager.get(), cmdQ, memoryProperties);
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
 }
+
+TEST_F(PageFaultManagerTest, givenManyTrackedAllocsWhenVerifyingPageFaultInsideAllocThenContainingAllocIsFound) {
+    for (uintptr_t i = 1; i <= 64; i++) {
+        pageFaultManager->insertAllocation(reinterpret_cast<void *>(i * 0x10000), 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    }
+    EXPECT_EQ(pageFaultManager->memoryData.size(), 64u);
+
+    auto alloc = reinterpret_cast<void *>(33 * 0x10000);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 0xFFF)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 0x1000u);
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 0x1000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xFFFF)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(65 * 0x10000)));
+    EXPECT_EQ(pageFaultManager->findAllocation(reinterpret_cast<void *>(64 * 0x10000 + 0x10)), pageFaultManager->memoryData.find(reinterpret_cast<void *>(64 * 0x10000)));
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeWhenVerifyingPageFaultOnGpuAllocThenOnlyFaultingChunkIsTransferredAndUnprotected) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmPageFaultMigrationChunkSize.set(MemoryConstants::pageSize64k);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    size_t size = 3 * MemoryConstants::pageSize64k + MemoryConstants::pageSize;
+
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunkSize, MemoryConstants::pageSize64k);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].cpuChunks.size(), 4u);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuOffset, 0u);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuSize, size);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * MemoryConstants::pageSize64k + 0x10));
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuOffset, 3 * MemoryConstants::pageSize64k);
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuSize, MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, 3 * MemoryConstants::pageSize64k));
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, MemoryConstants::pageSize);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Cpu);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 0x10));
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuOffset, 0u);
+    EXPECT_EQ(pageFaultManager->transferChunkToCpuSize, MemoryConstants::pageSize64k);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeWhenMovingToGpuDomainThenOnlyChunksAccessedByCpuAreTransferred) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmPageFaultMigrationChunkSize.set(MemoryConstants::pageSize64k);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+    size_t size = 4 * MemoryConstants::pageSize64k;
+
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, MemoryConstants::pageSize64k));
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * MemoryConstants::pageSize64k));
+    pageFaultManager->transferChunkToGpuCalled = 0;
+    pageFaultManager->protectMemoryCalled = 0;
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuOffset, MemoryConstants::pageSize64k);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuSize, 2 * MemoryConstants::pageSize64k);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, MemoryConstants::pageSize64k));
+    EXPECT_EQ(pageFaultManager->protectedSize, 2 * MemoryConstants::pageSize64k);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeAndAllocNotBiggerThanChunkWhenInsertingThenWholeAllocIsMigrated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmPageFaultMigrationChunkSize.set(MemoryConstants::pageSize64k);
+    void *alloc = reinterpret_cast<void *>(0x100000);
+
+    pageFaultManager->insertAllocation(alloc, MemoryConstants::pageSize64k, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].chunkSize, 0u);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferChunkToGpuCalled, 0);
+}
+
+TEST_F(PageFaultManagerTest, givenAdjacentCpuAllocsWhenMovingAllocsWithinUMAllocsManagerToGpuDomainThenTransfersAreFinishedOnceAndProtectionIsCoalesced) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+    void *alloc3 = reinterpret_cast<void *>(0x20000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->insertAllocation(alloc3, 0x2000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 3);
+    EXPECT_TRUE(pageFaultManager->transferToGpuBatched);
+    EXPECT_FALSE(pageFaultManager->batchTransfersToGpu);
+    EXPECT_EQ(pageFaultManager->finishTransfersToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 2);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, alloc3);
+    EXPECT_EQ(pageFaultManager->protectedSize, 0x2000u);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(statistics.transfersToGpu, 3u);
+    EXPECT_EQ(statistics.bytesTransferredToGpu, 0x4000u);
+    EXPECT_EQ(statistics.transfersToCpu, 0u);
+}
+
+TEST_F(PageFaultManagerTest, givenNoAllocsInCpuDomainWhenMovingAllocsWithinUMAllocsManagerToGpuDomainThenNothingIsTransferred) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    pageFaultManager->insertAllocation(alloc, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->memoryData.at(alloc).domain = PageFaultManager::AllocationDomain::None;
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->finishTransfersToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 0);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc).domain, PageFaultManager::AllocationDomain::Gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenBatchedUsmMigrationDisabledWhenMovingAllocsWithinUMAllocsManagerToGpuDomainThenEachAllocIsProtectedSeparately) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableBatchedUsmMigration.set(0);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_FALSE(pageFaultManager->transferToGpuBatched);
+    EXPECT_EQ(pageFaultManager->finishTransfersToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 2);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocMigratedBackAndForthWhenGettingMigrationStatisticsThenFaultsAndTransferredBytesAreReported) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(statistics.pageFaults, 2u);
+    EXPECT_EQ(statistics.transfersToCpu, 1u);
+    EXPECT_EQ(statistics.bytesTransferredToCpu, 0x1000u);
+    EXPECT_EQ(statistics.transfersToGpu, 2u);
+    EXPECT_EQ(statistics.bytesTransferredToGpu, 0x2000u);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocInGpuDomainWhenMovingToCpuDomainByInteriorPointerThenAllocIsTransferredAndUnprotected) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    pageFaultManager->moveAllocationToCpuDomain(ptrOffset(alloc, 0x10));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, 0x1000u);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+    EXPECT_TRUE(pageFaultManager->isAubWritable);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc).domain, PageFaultManager::AllocationDomain::Cpu);
+
+    pageFaultManager->moveAllocationToCpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocInNoneDomainWhenMovingToCpuDomainThenAllocIsUnprotectedWithoutTransfer) {
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+
+    pageFaultManager->insertAllocation(alloc, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, memoryProperties);
+    pageFaultManager->moveAllocationToCpuDomain(alloc);
+
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc).domain, PageFaultManager::AllocationDomain::Cpu);
+}
+
+TEST_F(PageFaultManagerTest, givenPredictionThresholdWhenAllocIsRepeatedlyAccessedByCpuAfterGpuPhaseThenItIsMigratedOnFaultOfAnotherAlloc) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationPredictionThreshold.set(2);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+    void *alloc3 = reinterpret_cast<void *>(0x30000);
+    auto umm = reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, umm, cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, umm, cmdQ, {});
+    pageFaultManager->insertAllocation(alloc3, 0x1000, umm, cmdQ, {});
+
+    for (int phase = 0; phase < 2; phase++) {
+        pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+        pageFaultManager->verifyPageFault(alloc1);
+        pageFaultManager->verifyPageFault(alloc2);
+    }
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc1).cpuAccessStreak, 2u);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).cpuAccessStreak, 2u);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc3).cpuAccessStreak, 0u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->transferToCpuCalled = 0;
+
+    pageFaultManager->verifyPageFault(alloc1);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, PageFaultManager::AllocationDomain::Cpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc3).domain, PageFaultManager::AllocationDomain::Gpu);
+
+    auto statistics = pageFaultManager->getMigrationStatistics();
+    EXPECT_EQ(statistics.pageFaults, 5u);
+    EXPECT_EQ(statistics.transfersToCpu, 6u);
+}
+
+TEST_F(PageFaultManagerTest, givenPrefetchedAllocWhenCpuAccessesItThenAccessIsAllowedWithoutTransferAndPredictionIsKept) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationPredictionThreshold.set(1);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+    auto umm = reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, umm, cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, umm, cmdQ, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    pageFaultManager->verifyPageFault(alloc2);
+    EXPECT_EQ(2u, pageFaultManager->predictedAllocations.size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc2).prefetchedToCpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, PageFaultManager::AllocationDomain::Cpu);
+
+    pageFaultManager->transferToCpuCalled = 0;
+    pageFaultManager->allowMemoryAccessCalled = 0;
+    pageFaultManager->verifyPageFault(alloc2);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_FALSE(pageFaultManager->memoryData.at(alloc2).prefetchedToCpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).cpuAccessStreak, 2u);
+    EXPECT_EQ(1u, pageFaultManager->predictedAllocations.count(alloc2));
+
+    pageFaultManager->transferToGpuCalled = 0;
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+}
+
+TEST_F(PageFaultManagerTest, givenPrefetchedAllocNotAccessedByCpuWhenMovingToGpuDomainThenItIsNotTransferredAndPredictionIsDropped) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationPredictionThreshold.set(1);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+    auto umm = reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, umm, cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, umm, cmdQ, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    pageFaultManager->verifyPageFault(alloc2);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc2).prefetchedToCpu);
+
+    pageFaultManager->transferToGpuCalled = 0;
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc1);
+    EXPECT_EQ(pageFaultManager->discardCpuCopyCalled, 1);
+    EXPECT_EQ(pageFaultManager->discardCpuCopyAddress, alloc2);
+    EXPECT_FALSE(pageFaultManager->memoryData.at(alloc2).prefetchedToCpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, PageFaultManager::AllocationDomain::Gpu);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).cpuAccessStreak, 0u);
+    EXPECT_EQ(0u, pageFaultManager->predictedAllocations.count(alloc2));
+
+    pageFaultManager->transferToCpuCalled = 0;
+    pageFaultManager->verifyPageFault(alloc1);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc2).domain, PageFaultManager::AllocationDomain::Gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenPrefetchedAllocWhenRemovedThenCpuAccessIsAllowed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationPredictionThreshold.set(1);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+    auto umm = reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, umm, cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, umm, cmdQ, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    pageFaultManager->verifyPageFault(alloc2);
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(umm);
+    pageFaultManager->verifyPageFault(alloc1);
+    EXPECT_TRUE(pageFaultManager->memoryData.at(alloc2).prefetchedToCpu);
+
+    pageFaultManager->allowMemoryAccessCalled = 0;
+    pageFaultManager->removeAllocation(alloc2);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(0u, pageFaultManager->predictedAllocations.count(alloc2));
+}
+
+TEST_F(PageFaultManagerTest, givenAllocNotAccessedByCpuDuringPhaseWhenMovingToGpuDomainThenCpuAccessStreakIsReset) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc).cpuAccessStreak, 1u);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->memoryData.at(alloc).cpuAccessStreak, 0u);
+}
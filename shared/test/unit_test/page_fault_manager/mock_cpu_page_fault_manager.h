@@ -13,12 +13,15 @@ using namespace NEO;
 
 class MockPageFaultManager : public PageFaultManager {
   public:
+    using PageFaultManager::batchTransfersToGpu;
+    using PageFaultManager::findAllocation;
     using PageFaultManager::gpuDomainHandler;
     using PageFaultManager::handleGpuDomainTransferForAubAndTbx;
     using PageFaultManager::handleGpuDomainTransferForHw;
     using PageFaultManager::memoryData;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
+    using PageFaultManager::predictedAllocations;
     using PageFaultManager::selectGpuDomainHandler;
     using PageFaultManager::verifyPageFault;
 
@@ -39,8 +42,26 @@ class MockPageFaultManager : public PageFaultManager {
     }
     void transferToGpu(void *ptr, void *cmdQ) override {
         transferToGpuCalled++;
+        transferToGpuBatched = batchTransfersToGpu;
         transferToGpuAddress = ptr;
     }
+    void transferChunkToCpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) override {
+        transferChunkToCpuCalled++;
+        transferChunkToCpuOffset = offset;
+        transferChunkToCpuSize = size;
+    }
+    void transferChunkToGpu(void *allocPtr, size_t offset, size_t size, void *cmdQ) override {
+        transferChunkToGpuCalled++;
+        transferChunkToGpuOffset = offset;
+        transferChunkToGpuSize = size;
+    }
+    void finishTransfersToGpu() override {
+        finishTransfersToGpuCalled++;
+    }
+    void discardCpuCopy(void *ptr, void *cmdQ) override {
+        discardCpuCopyCalled++;
+        discardCpuCopyAddress = ptr;
+    }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
     }
@@ -67,14 +88,24 @@ class MockPageFaultManager : public PageFaultManager {
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int transferChunkToCpuCalled = 0;
+    int transferChunkToGpuCalled = 0;
+    int finishTransfersToGpuCalled = 0;
+    int discardCpuCopyCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
+    void *discardCpuCopyAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferChunkToCpuOffset = 0;
+    size_t transferChunkToCpuSize = 0;
+    size_t transferChunkToGpuOffset = 0;
+    size_t transferChunkToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
+    bool transferToGpuBatched = false;
 };
 
 template <class T>
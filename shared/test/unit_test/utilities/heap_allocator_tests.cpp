@@ -12,7 +12,9 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <map>
 #include <random>
+#include <vector>
 
 using namespace NEO;
 
@@ -31,18 +33,32 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     size_t getThresholdSize() const { return this->sizeThreshold; }
     using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec, size_t requiredAlignment) {
+    uint64_t getFromFreedChunks(size_t size, HeapFreedChunks &freedChunks, size_t requiredAlignment) {
         size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk, requiredAlignment);
+        return HeapAllocator::getFromFreedChunks(size, freedChunks, sizeOfFreedChunk, requiredAlignment);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, HeapFreedChunks &freedChunks) { return HeapAllocator::storeInFreedChunks(ptr, size, freedChunks); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    HeapFreedChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    HeapFreedChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
 
+struct HeapChunk {
+    HeapChunk(uint64_t ptr, size_t size) : ptr(ptr), size(size) {}
+    uint64_t ptr;
+    size_t size;
+};
+
+static std::vector<HeapChunk> getChunksByAddress(HeapFreedChunks &freedChunks) {
+    std::vector<HeapChunk> chunks;
+    for (auto &chunk : freedChunks) {
+        chunks.emplace_back(chunk.first, chunk.second);
+    }
+    return chunks;
+}
+
 TEST(HeapAllocatorTest, WhenHeapAllocatorIsCreatedWithAlignmentThenAlignmentIsSet) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -79,10 +95,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.emplace(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks, allocationAlignment);
 
@@ -95,15 +111,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.emplace(0x100000llu, 4096);
+    freedChunks.emplace(0x101000llu, 4096);
+    freedChunks.emplace(0x105000llu, 4096);
+    freedChunks.emplace(0x104000llu, 4096);
+    freedChunks.emplace(0x102000llu, 8192);
+    freedChunks.emplace(0x109000llu, 8192);
+    freedChunks.emplace(0x107000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -120,21 +136,22 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.emplace(pUpperBound, 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.emplace(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.emplace(pUpperBound, 4 * 4096);
 
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.emplace(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.emplace(pUpperBound, 4 * 4096);
+    // equally good fits are taken from the lowest address
+    ptrExpected = pUpperBound;
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -151,15 +168,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.emplace(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.emplace(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.emplace(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -171,8 +188,8 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    EXPECT_EQ(pLowerBound, getChunksByAddress(freedChunks)[2].ptr);
+    EXPECT_EQ(deltaSize, getChunksByAddress(freedChunks)[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -182,18 +199,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.emplace(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.emplace(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksByAddress(freedChunks)[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -206,8 +223,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksByAddress(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -217,11 +234,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.emplace(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -229,11 +246,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.emplace(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksByAddress(freedChunks)[1].size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -244,8 +261,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(expectedSize, getChunksByAddress(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -255,11 +272,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.emplace(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.emplace(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -273,8 +290,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(ptrToStore, getChunksByAddress(freedChunks)[2].ptr);
+    EXPECT_EQ(sizeToStore, getChunksByAddress(freedChunks)[2].size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCalledThenChunksAreMerged) {
@@ -282,10 +299,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkExpandableByIncomingChunkWhenStoreIsCall
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    HeapFreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x103000llu, 4096);
+    freedChunks.emplace(0x100000llu, 4096);
+    freedChunks.emplace(0x103000llu, 4096);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -756,6 +773,84 @@ TEST(HeapAllocatorTest, WhenMemoryIsAllocatedThenAllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
+TEST(HeapAllocatorTest, GivenFreedChunkClosingGapBetweenStoredChunksWhenStoreIsCalledThenAllThreeChunksAreMerged) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    HeapFreedChunks freedChunks;
+
+    freedChunks.emplace(0x100000llu, 4096);
+    freedChunks.emplace(0x108000llu, 4096);
+    freedChunks.emplace(0x103000llu, 2 * 4096);
+
+    heapAllocator->storeInFreedChunks(0x105000llu, 3 * 4096, freedChunks);
+
+    ASSERT_EQ(2u, freedChunks.size());
+    EXPECT_EQ(0x100000llu, getChunksByAddress(freedChunks)[0].ptr);
+    EXPECT_EQ(4096u, getChunksByAddress(freedChunks)[0].size);
+    EXPECT_EQ(0x103000llu, getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(6 * 4096u, getChunksByAddress(freedChunks)[1].size);
+
+    heapAllocator->storeInFreedChunks(0x101000llu, 2 * 4096, freedChunks);
+
+    ASSERT_EQ(1u, freedChunks.size());
+    EXPECT_EQ(0x100000llu, getChunksByAddress(freedChunks)[0].ptr);
+    EXPECT_EQ(9 * 4096u, getChunksByAddress(freedChunks)[0].size);
+}
+
+TEST(HeapAllocatorTest, GivenLongRandomAllocationTraceWhenFreeingThenFreedChunksAreCoalescedImmediately) {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<size_t> pagesDistribution(1, 32);
+
+    const uint64_t heapBase = 0x100000000llu;
+    const size_t heapSize = 16384 * MemoryConstants::pageSize;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(heapBase, heapSize, allocationAlignment, sizeThreshold);
+
+    auto expectNoAdjacentChunks = [](HeapFreedChunks &freedChunks) {
+        auto chunks = getChunksByAddress(freedChunks);
+        for (size_t i = 1; i < chunks.size(); i++) {
+            EXPECT_LT(chunks[i - 1].ptr + chunks[i - 1].size, chunks[i].ptr);
+        }
+    };
+
+    std::map<uint64_t, size_t> liveAllocations;
+    for (uint32_t i = 0; i < 20000; i++) {
+        if (liveAllocations.empty() || generator() % 3 != 0) {
+            size_t sizeToAllocate = pagesDistribution(generator) * MemoryConstants::pageSize;
+            auto ptr = heapAllocator->allocate(sizeToAllocate);
+            if (ptr == 0llu) {
+                continue;
+            }
+            auto next = liveAllocations.lower_bound(ptr);
+            if (next != liveAllocations.end()) {
+                ASSERT_LE(ptr + sizeToAllocate, next->first);
+            }
+            if (next != liveAllocations.begin()) {
+                auto previous = std::prev(next);
+                ASSERT_LE(previous->first + previous->second, ptr);
+            }
+            liveAllocations[ptr] = sizeToAllocate;
+        } else {
+            auto toFree = std::next(liveAllocations.begin(), generator() % liveAllocations.size());
+            heapAllocator->free(toFree->first, toFree->second);
+            liveAllocations.erase(toFree);
+            expectNoAdjacentChunks(heapAllocator->getFreedChunksSmall());
+            expectNoAdjacentChunks(heapAllocator->getFreedChunksBig());
+        }
+    }
+
+    for (auto &allocation : liveAllocations) {
+        heapAllocator->free(allocation.first, allocation.second);
+    }
+    EXPECT_EQ(heapSize, heapAllocator->getavailableSize());
+
+    size_t totalSize = heapSize;
+    auto finalPtr = heapAllocator->allocate(totalSize);
+    EXPECT_EQ(heapBase, finalPtr);
+    heapAllocator->free(finalPtr, totalSize);
+}
+
 TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
@@ -768,7 +863,7 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -795,21 +890,19 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ(basePtr, getChunksByAddress(freedChunks)[0].ptr);
+    EXPECT_EQ(3 * allocSize, getChunksByAddress(freedChunks)[0].size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(5 * allocSize, getChunksByAddress(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented) {
@@ -825,7 +918,7 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -852,21 +945,19 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), getChunksByAddress(freedChunks)[0].ptr);
+    EXPECT_EQ(5 * allocSize, getChunksByAddress(freedChunks)[0].size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), getChunksByAddress(freedChunks)[1].ptr);
+    EXPECT_EQ(3 * allocSize, getChunksByAddress(freedChunks)[1].size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -876,7 +967,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -912,8 +1003,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -973,8 +1064,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    HeapFreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    HeapFreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];